@@ -0,0 +1,42 @@
+#ifndef S21_BENCH_H_
+#define S21_BENCH_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+namespace s21_bench {
+// Problem size from the first command line argument, or fallback
+inline std::size_t arg_size(int argc, char **argv, std::size_t fallback) {
+  return argc > 1 ? std::strtoull(argv[1], nullptr, 10) : fallback;
+}
+
+inline std::mt19937_64 &rng() {
+  static std::mt19937_64 engine(42);
+  return engine;
+}
+
+template <typename F>
+double seconds(F &&body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+inline void report(const char *name, std::size_t ops, double elapsed) {
+  std::printf("%-44s %10zu ops %9.3f s %10.2f Mops/s\n", name, ops, elapsed,
+              ops / elapsed / 1e6);
+}
+
+// Keeps the optimizer from discarding a computed result
+template <typename T>
+inline void do_not_optimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+}  // namespace s21_bench
+
+#endif
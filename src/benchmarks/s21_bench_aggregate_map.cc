@@ -0,0 +1,42 @@
+#include <cstdint>
+
+#include "../s21_aggregate_map.h"
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Range sums over random key windows: aggregate_map::aggregate() versus
+// a walk over an s21::map, which has to visit every entry.
+int main(int argc, char **argv) {
+  const std::size_t size = s21_bench::arg_size(argc, argv, 1000000);
+  const std::size_t queries = 1000000;
+  const std::size_t walks = 20;
+
+  s21::aggregate_map<std::uint64_t, std::int64_t> sums;
+  s21::map<std::uint64_t, std::int64_t> counters;
+  for (std::size_t i = 0; i < size; ++i) {
+    std::uint64_t key = s21_bench::rng()() % (size * 4);
+    sums.accumulate(key, 1);
+    counters[key] += 1;
+  }
+  std::printf("%zu keys, windows of 1/8 of the key space\n", sums.size());
+
+  std::int64_t total = 0;
+  double elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < queries; ++i) {
+      std::uint64_t lower = s21_bench::rng()() % (size * 4);
+      total += sums.aggregate(lower, lower + size / 2);
+    }
+  });
+  s21_bench::report("aggregate_map aggregate", queries, elapsed);
+
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < walks; ++i) {
+      for (auto it = counters.begin(); it != counters.end(); ++it) {
+        total += *it;
+      }
+    }
+  });
+  s21_bench::report("map walk", walks, elapsed);
+  s21_bench::do_not_optimize(total);
+  return 0;
+}
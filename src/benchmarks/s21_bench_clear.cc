@@ -0,0 +1,52 @@
+#include <cstdint>
+#include <future>
+
+#include "../s21_arena.h"
+#include "../s21_list.h"
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Time a container spends inside clear(): the regular per-node teardown, an
+// arena-backed container that drops its arena, and clear_async(), measured
+// until the call returns.
+template <typename Container, typename Fill>
+void run(const char *name, std::size_t size, Fill fill, bool async) {
+  Container container;
+  fill(container, size);
+  std::future<void> done;
+  double elapsed = s21_bench::seconds([&] {
+    if (async) {
+      done = container.clear_async();
+    } else {
+      container.clear();
+    }
+  });
+  s21_bench::report(name, size, elapsed);
+  if (done.valid()) done.get();
+}
+
+int main(int argc, char **argv) {
+  const std::size_t size = s21_bench::arg_size(argc, argv, 5000000);
+  using pool_map = s21::map<
+      std::uint64_t, std::uint64_t, std::less<std::uint64_t>,
+      s21::arena_allocator<std::pair<const std::uint64_t, std::uint64_t>>>;
+  using pool_list =
+      s21::list<std::uint64_t, s21::arena_allocator<std::uint64_t>>;
+
+  auto fill_map = [](auto &map, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) map.insert(s21_bench::rng()(), i);
+  };
+  auto fill_list = [](auto &list, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) list.push_back(i);
+  };
+
+  using map = s21::map<std::uint64_t, std::uint64_t>;
+  using list = s21::list<std::uint64_t>;
+  run<map>("map clear", size, fill_map, false);
+  run<pool_map>("map clear, arena", size, fill_map, false);
+  run<map>("map clear_async (caller side)", size, fill_map, true);
+  run<list>("list clear", size, fill_list, false);
+  run<pool_list>("list clear, arena", size, fill_list, false);
+  run<list>("list clear_async (caller side)", size, fill_list, true);
+  return 0;
+}
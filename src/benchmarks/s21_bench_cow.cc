@@ -0,0 +1,56 @@
+#include <cstdint>
+
+#include "../s21_cow.h"
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Handing out private views of a map: a deep copy per request against a
+// cow_map copy, for requests that only read and for the rare one that
+// writes (and so pays the deep copy once).
+namespace {
+constexpr std::size_t kRequests = 200;
+
+std::uint64_t read_some(const s21::map<std::uint64_t, std::uint64_t> &view) {
+  std::uint64_t sum = 0;
+  for (std::uint64_t key = 0; key < 1000; ++key) {
+    auto it = view.find(key * 7);
+    if (it != view.end()) sum += *it;
+  }
+  return sum;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = s21_bench::arg_size(argc, argv, 200000);
+  s21::cow_map<std::uint64_t, std::uint64_t> shared;
+  for (std::uint64_t key = 0; key < n; ++key) shared.write().insert(key, key);
+  std::printf("map of %zu entries, %zu requests\n", n, kRequests);
+
+  std::uint64_t sum = 0;
+  double elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < kRequests; ++i) {
+      s21::map<std::uint64_t, std::uint64_t> view(*shared);
+      sum += read_some(view);
+    }
+  });
+  s21_bench::report("  deep copy, read", kRequests, elapsed);
+
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < kRequests; ++i) {
+      s21::cow_map<std::uint64_t, std::uint64_t> view(shared);
+      sum -= read_some(*view);
+    }
+  });
+  s21_bench::report("  cow copy, read", kRequests, elapsed);
+
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < kRequests; ++i) {
+      s21::cow_map<std::uint64_t, std::uint64_t> view(shared);
+      sum += read_some(*view);
+      if (i % 10 == 0) view.write()[i] = 0;
+    }
+  });
+  s21_bench::report("  cow copy, read, 1 in 10 writes", kRequests, elapsed);
+  s21_bench::do_not_optimize(sum);
+  return 0;
+}
@@ -0,0 +1,128 @@
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "../s21_indexed_heap.h"
+#include "../s21_priority_queue.h"
+#include "../s21_set.h"
+#include "s21_bench.h"
+
+// Single-source shortest paths over a random graph: n nodes, each with an
+// edge to its successor and 4 random ones. indexed_heap with decrease_key
+// versus a priority_queue with lazy deletion and an s21::set with
+// erase+insert.
+namespace {
+using distance = std::uint64_t;
+constexpr distance kInfinity = std::numeric_limits<distance>::max();
+
+struct graph {
+  std::vector<std::uint32_t> offsets, targets, weights;
+};
+
+graph make_graph(std::size_t nodes) {
+  graph g;
+  g.offsets.reserve(nodes + 1);
+  for (std::size_t node = 0; node < nodes; ++node) {
+    g.offsets.push_back(g.targets.size());
+    g.targets.push_back((node + 1) % nodes);
+    g.weights.push_back(1000);
+    for (int edge = 0; edge < 4; ++edge) {
+      g.targets.push_back(s21_bench::rng()() % nodes);
+      g.weights.push_back(1 + s21_bench::rng()() % 1000);
+    }
+  }
+  g.offsets.push_back(g.targets.size());
+  return g;
+}
+
+std::vector<distance> with_indexed_heap(const graph &g) {
+  std::size_t nodes = g.offsets.size() - 1;
+  std::vector<distance> dist(nodes, kInfinity);
+  std::vector<std::size_t> handle(nodes);
+  s21::indexed_heap<std::pair<distance, std::uint32_t>> heap;
+  heap.reserve(nodes);
+  dist[0] = 0;
+  handle[0] = heap.push({0, 0});
+  while (!heap.empty()) {
+    auto [d, node] = heap.top();
+    heap.pop();
+    for (auto e = g.offsets[node]; e < g.offsets[node + 1]; ++e) {
+      std::uint32_t next = g.targets[e];
+      distance candidate = d + g.weights[e];
+      if (candidate >= dist[next]) continue;
+      if (dist[next] == kInfinity) {
+        handle[next] = heap.push({candidate, next});
+      } else {
+        heap.decrease_key(handle[next], {candidate, next});
+      }
+      dist[next] = candidate;
+    }
+  }
+  return dist;
+}
+
+std::vector<distance> with_lazy_queue(const graph &g) {
+  std::size_t nodes = g.offsets.size() - 1;
+  std::vector<distance> dist(nodes, kInfinity);
+  s21::priority_queue<std::pair<distance, std::uint32_t>,
+                      s21::vector<std::pair<distance, std::uint32_t>>,
+                      std::greater<std::pair<distance, std::uint32_t>>>
+      queue;
+  dist[0] = 0;
+  queue.push({0, 0});
+  while (!queue.empty()) {
+    auto [d, node] = queue.top();
+    queue.pop();
+    if (d > dist[node]) continue;
+    for (auto e = g.offsets[node]; e < g.offsets[node + 1]; ++e) {
+      std::uint32_t next = g.targets[e];
+      distance candidate = d + g.weights[e];
+      if (candidate >= dist[next]) continue;
+      dist[next] = candidate;
+      queue.push({candidate, next});
+    }
+  }
+  return dist;
+}
+
+std::vector<distance> with_set(const graph &g) {
+  std::size_t nodes = g.offsets.size() - 1;
+  std::vector<distance> dist(nodes, kInfinity);
+  s21::set<std::pair<distance, std::uint32_t>> queue;
+  dist[0] = 0;
+  queue.insert({0, 0});
+  while (!queue.empty()) {
+    auto [d, node] = *queue.begin();
+    queue.erase(queue.begin());
+    for (auto e = g.offsets[node]; e < g.offsets[node + 1]; ++e) {
+      std::uint32_t next = g.targets[e];
+      distance candidate = d + g.weights[e];
+      if (candidate >= dist[next]) continue;
+      if (dist[next] != kInfinity) queue.erase({dist[next], next});
+      dist[next] = candidate;
+      queue.insert({candidate, next});
+    }
+  }
+  return dist;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t nodes = s21_bench::arg_size(argc, argv, 1000000);
+  graph g = make_graph(nodes);
+  std::printf("%zu nodes, %zu edges\n", nodes, g.targets.size());
+
+  std::vector<distance> expected, actual;
+  double elapsed = s21_bench::seconds([&] { expected = with_indexed_heap(g); });
+  s21_bench::report("indexed_heap decrease_key", nodes, elapsed);
+
+  elapsed = s21_bench::seconds([&] { actual = with_lazy_queue(g); });
+  s21_bench::report("priority_queue, lazy deletion", nodes, elapsed);
+  if (actual != expected) std::printf("  distances differ!\n");
+
+  elapsed = s21_bench::seconds([&] { actual = with_set(g); });
+  s21_bench::report("set, erase+insert", nodes, elapsed);
+  if (actual != expected) std::printf("  distances differ!\n");
+  return 0;
+}
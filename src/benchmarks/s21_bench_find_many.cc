@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Batched lookups against a large map: a loop of find() versus find_many()
+// and contains_many() over batches of 64..256 keys.
+int main(int argc, char **argv) {
+  const std::size_t size = s21_bench::arg_size(argc, argv, 10000000);
+  const std::size_t queries = 4000000;
+
+  s21::map<std::uint32_t, std::uint32_t> map;
+  std::vector<std::uint32_t> keys(queries);
+  for (std::size_t i = 0; i < size; ++i) {
+    map.insert(static_cast<std::uint32_t>(s21_bench::rng()()), i);
+  }
+  for (auto &key : keys) {
+    key = static_cast<std::uint32_t>(s21_bench::rng()());
+  }
+  std::printf("map of %zu keys, %zu lookups\n", map.size(), queries);
+
+  for (std::size_t batch : {64, 128, 256}) {
+    std::size_t hits = 0;
+    double elapsed = s21_bench::seconds([&] {
+      for (std::size_t i = 0; i < queries; i += batch) {
+        for (std::size_t j = i; j < i + batch && j < queries; ++j) {
+          hits += map.find(keys[j]) != map.end();
+        }
+      }
+    });
+    std::printf("batch %zu\n", batch);
+    s21_bench::report("  find loop", queries, elapsed);
+    s21_bench::do_not_optimize(hits);
+
+    std::vector<s21::map<std::uint32_t, std::uint32_t>::iterator> found;
+    found.reserve(batch);
+    elapsed = s21_bench::seconds([&] {
+      for (std::size_t i = 0; i < queries; i += batch) {
+        found.clear();
+        auto last = keys.begin() + std::min(i + batch, queries);
+        map.find_many(keys.begin() + i, last, std::back_inserter(found));
+        hits += found.back() != map.end();
+      }
+    });
+    s21_bench::report("  find_many", queries, elapsed);
+
+    std::vector<char> present(batch);
+    elapsed = s21_bench::seconds([&] {
+      for (std::size_t i = 0; i < queries; i += batch) {
+        auto last = keys.begin() + std::min(i + batch, queries);
+        map.contains_many(keys.begin() + i, last, present.begin());
+        hits += present[0];
+      }
+    });
+    s21_bench::report("  contains_many", queries, elapsed);
+    s21_bench::do_not_optimize(hits);
+  }
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_frozen.h"
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Lookups of HTTP header names: the table built at startup as an s21::map,
+// against a frozen_map built by the compiler (perfect hash) and the same
+// table forced onto binary search by a comparator-only key.
+namespace {
+using header_table = std::pair<std::string_view, int>[24];
+
+constexpr header_table kHeaders = {
+    {"accept", 0},           {"accept-encoding", 1},
+    {"accept-language", 2},  {"authorization", 3},
+    {"cache-control", 4},    {"connection", 5},
+    {"content-encoding", 6}, {"content-length", 7},
+    {"content-type", 8},     {"cookie", 9},
+    {"date", 10},            {"etag", 11},
+    {"expires", 12},         {"host", 13},
+    {"if-match", 14},        {"if-none-match", 15},
+    {"last-modified", 16},   {"location", 17},
+    {"origin", 18},          {"range", 19},
+    {"referer", 20},         {"server", 21},
+    {"set-cookie", 22},      {"user-agent", 23},
+};
+
+constexpr auto kHashed = s21::frozen_map<std::string_view, int, 24>(kHeaders);
+
+struct no_hash {};
+
+constexpr auto kSorted =
+    s21::frozen_map<std::string_view, int, 24, std::less<std::string_view>,
+                    no_hash>(kHeaders);
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = s21_bench::arg_size(argc, argv, 10000000);
+  static_assert(decltype(kHashed)::kHashed && !decltype(kSorted)::kHashed);
+
+  std::vector<std::string> lookups;
+  for (std::size_t i = 0; i < 1024; ++i) {
+    lookups.emplace_back(kHeaders[s21_bench::rng()() % 24].first);
+  }
+
+  s21::map<std::string, int> startup;
+  double elapsed = s21_bench::seconds([&] {
+    for (const auto &header : kHeaders) {
+      startup.insert(std::string(header.first), header.second);
+    }
+  });
+  std::printf("s21::map built in %.1f us, %zu allocations\n", elapsed * 1e6,
+              startup.memory_usage().allocations);
+
+  long sum = 0;
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < n; ++i) sum += startup.at(lookups[i & 1023]);
+  });
+  s21_bench::report("s21::map<std::string, int> at", n, elapsed);
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < n; ++i) sum -= kSorted.at(lookups[i & 1023]);
+  });
+  s21_bench::report("frozen_map at, binary search", n, elapsed);
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < n; ++i) sum += kHashed.at(lookups[i & 1023]);
+  });
+  s21_bench::report("frozen_map at, perfect hash", n, elapsed);
+  s21_bench::do_not_optimize(sum);
+  return 0;
+}
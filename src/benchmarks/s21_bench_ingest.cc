@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "../s21_map.h"
+#include "../s21_set.h"
+#include "s21_bench.h"
+
+// Time-series style ingest into s21::set and s21::map: sorted keys, nearly
+// sorted keys (one in a hundred arrives a few places late), and random keys
+// for reference; plain insert against insert at the end() hint, with
+// std::set alongside.
+namespace {
+std::vector<std::uint64_t> sorted_keys(std::size_t n) {
+  std::vector<std::uint64_t> keys(n);
+  for (std::size_t i = 0; i < n; ++i) keys[i] = i * 10;
+  return keys;
+}
+
+std::vector<std::uint64_t> nearly_sorted_keys(std::size_t n) {
+  std::vector<std::uint64_t> keys = sorted_keys(n);
+  for (std::size_t i = 16; i < n; ++i) {
+    if (s21_bench::rng()() % 100 == 0) {
+      std::swap(keys[i], keys[i - 1 - s21_bench::rng()() % 16]);
+    }
+  }
+  return keys;
+}
+
+std::vector<std::uint64_t> random_keys(std::size_t n) {
+  std::vector<std::uint64_t> keys = sorted_keys(n);
+  std::shuffle(keys.begin(), keys.end(), s21_bench::rng());
+  return keys;
+}
+
+void run(const char *name, const std::vector<std::uint64_t> &keys) {
+  const std::size_t n = keys.size();
+  std::printf("%s, %zu keys\n", name, n);
+  {
+    s21::set<std::uint64_t> set;
+    double elapsed = s21_bench::seconds([&] {
+      for (std::uint64_t key : keys) set.insert(key);
+    });
+    s21_bench::report("  s21::set insert", n, elapsed);
+  }
+  {
+    s21::set<std::uint64_t> set;
+    double elapsed = s21_bench::seconds([&] {
+      for (std::uint64_t key : keys) set.insert(set.end(), key);
+    });
+    s21_bench::report("  s21::set insert(end(), key)", n, elapsed);
+  }
+  {
+    s21::map<std::uint64_t, std::uint64_t> map;
+    double elapsed = s21_bench::seconds([&] {
+      for (std::uint64_t key : keys) map.insert(key, key);
+    });
+    s21_bench::report("  s21::map insert", n, elapsed);
+  }
+  {
+    std::set<std::uint64_t> set;
+    double elapsed = s21_bench::seconds([&] {
+      for (std::uint64_t key : keys) set.insert(key);
+    });
+    s21_bench::report("  std::set insert", n, elapsed);
+  }
+  {
+    std::set<std::uint64_t> set;
+    double elapsed = s21_bench::seconds([&] {
+      for (std::uint64_t key : keys) set.insert(set.end(), key);
+    });
+    s21_bench::report("  std::set insert(end(), key)", n, elapsed);
+  }
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = s21_bench::arg_size(argc, argv, 2000000);
+  run("sorted", sorted_keys(n));
+  run("nearly sorted", nearly_sorted_keys(n));
+  run("random", random_keys(n));
+  return 0;
+}
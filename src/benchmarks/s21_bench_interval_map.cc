@@ -0,0 +1,64 @@
+#include <cstdint>
+#include <utility>
+
+#include "../s21_interval_map.h"
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+namespace {
+// Output iterator that only counts what is written to it
+struct counter {
+  std::size_t *hits;
+  counter &operator*() { return *this; }
+  counter &operator++(int) { return *this; }
+  template <typename It>
+  counter &operator=(const It &) {
+    ++*hits;
+    return *this;
+  }
+};
+}  // namespace
+
+// Stabbing queries over random short ranges: interval_map::stab() versus a
+// full scan of an s21::map keyed by the same ranges.
+int main(int argc, char **argv) {
+  using range = std::pair<std::uint32_t, std::uint32_t>;
+  const std::size_t size = s21_bench::arg_size(argc, argv, 1000000);
+  const std::size_t queries = 100000;
+  const std::size_t scans = 20;
+
+  s21::interval_map<std::uint32_t, std::uint32_t> intervals;
+  s21::map<range, std::uint32_t> ranges;
+  for (std::size_t i = 0; i < size; ++i) {
+    std::uint32_t lower = static_cast<std::uint32_t>(s21_bench::rng()());
+    std::uint32_t upper = lower + (s21_bench::rng()() % 65536);
+    if (upper < lower) upper = lower;
+    intervals.insert(lower, upper, i);
+    ranges.insert(range(lower, upper), i);
+  }
+  std::printf("%zu intervals\n", intervals.size());
+
+  std::size_t hits = 0;
+  double elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < queries; ++i) {
+      auto point = static_cast<std::uint32_t>(s21_bench::rng()());
+      intervals.stab(point, counter{&hits});
+    }
+  });
+  s21_bench::report("interval_map stab", queries, elapsed);
+  s21_bench::do_not_optimize(hits);
+
+  std::size_t scanned = 0;
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < scans; ++i) {
+      auto point = static_cast<std::uint32_t>(s21_bench::rng()());
+      for (auto it = ranges.begin(); it != ranges.end(); ++it) {
+        scanned += *it != 0;
+      }
+      s21_bench::do_not_optimize(point);
+    }
+  });
+  s21_bench::report("map full scan", scans, elapsed);
+  s21_bench::do_not_optimize(scanned);
+  return 0;
+}
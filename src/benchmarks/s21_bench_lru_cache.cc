@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "../s21_lru_cache.h"
+#include "s21_bench.h"
+
+// Hit rate and throughput of lru_cache under a Zipf(0.9) workload over 1M
+// keys, with and without a sequential scan of cold keys mixed in after every
+// 10 requests.
+namespace {
+std::vector<double> zipf_cdf(std::size_t keys, double skew) {
+  std::vector<double> cdf(keys);
+  double sum = 0;
+  for (std::size_t i = 0; i < keys; ++i) {
+    sum += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+    cdf[i] = sum;
+  }
+  for (auto &value : cdf) value /= sum;
+  return cdf;
+}
+
+void run(const char *name, s21::lru_policy policy, std::size_t capacity,
+         const std::vector<std::uint64_t> &requests) {
+  s21::lru_cache<std::uint64_t, std::uint64_t> cache(capacity, policy);
+  double elapsed = s21_bench::seconds([&] {
+    for (std::uint64_t key : requests) {
+      if (!cache.get(key)) cache.put(key, key);
+    }
+  });
+  s21_bench::report(name, requests.size(), elapsed);
+  std::printf("%-44s %9.2f %%\n", "  hit rate",
+              100.0 * cache.hits() / requests.size());
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t requests = s21_bench::arg_size(argc, argv, 5000000);
+  const std::size_t keys = 1000000;
+  const std::size_t capacity = 50000;
+
+  auto cdf = zipf_cdf(keys, 0.9);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::vector<std::uint64_t> zipf(requests), scanned;
+  std::uint64_t scan_key = keys;
+  for (std::size_t i = 0; i < requests; ++i) {
+    double u = uniform(s21_bench::rng());
+    zipf[i] = std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+    scanned.push_back(zipf[i]);
+    if (i % 10 == 9) {
+      for (int j = 0; j < 10; ++j) scanned.push_back(scan_key++);
+    }
+  }
+  std::printf("%zu keys, capacity %zu\n", keys, capacity);
+
+  run("zipf, lru", s21::lru_policy::lru, capacity, zipf);
+  run("zipf, segmented", s21::lru_policy::segmented, capacity, zipf);
+  run("zipf + scans, lru", s21::lru_policy::lru, capacity, scanned);
+  run("zipf + scans, segmented", s21::lru_policy::segmented, capacity,
+      scanned);
+  return 0;
+}
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../s21_map.h"
+#include "../s21_multimap.h"
+#include "../s21_vector.h"
+#include "s21_bench.h"
+
+// multimap against s21::map<K, s21::vector<V>> as a secondary index from a
+// 64-bit key to 32-bit row ids: building it, reading every row of looked-up
+// keys, erasing single (key, row) pairs, and the memory each one holds. Keys
+// are drawn from a small domain, where most keys collect many rows, and from
+// a large one, where most keys have one or two.
+namespace {
+using rows_map = s21::map<std::uint64_t, s21::vector<std::uint32_t>>;
+
+std::size_t memory_of(const rows_map &index) {
+  std::size_t bytes = index.memory_usage().total_bytes();
+  for (auto it = index.begin(); it != index.end(); ++it) {
+    bytes += (*it).memory_usage().total_bytes();
+  }
+  return bytes;
+}
+
+void run(const char *name, std::size_t n, std::uint64_t domain) {
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> rows(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    rows[i] = {s21_bench::rng()() % domain, static_cast<std::uint32_t>(i)};
+  }
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> doomed(rows);
+  std::shuffle(doomed.begin(), doomed.end(), s21_bench::rng());
+  doomed.resize(n / 10);
+  std::printf("%s, %zu rows\n", name, n);
+
+  std::uint64_t sum = 0;
+  std::size_t nested_bytes, index_bytes;
+  {
+    rows_map nested;
+    double elapsed = s21_bench::seconds([&] {
+      for (const auto &row : rows) nested[row.first].push_back(row.second);
+    });
+    s21_bench::report("  map<K, vector<V>> insert", n, elapsed);
+    elapsed = s21_bench::seconds([&] {
+      for (const auto &row : doomed) {
+        for (std::uint32_t id : nested.at(row.first)) sum += id;
+      }
+    });
+    s21_bench::report("  map<K, vector<V>> scan key", doomed.size(), elapsed);
+    nested_bytes = memory_of(nested);
+    elapsed = s21_bench::seconds([&] {
+      for (const auto &row : doomed) {
+        auto &ids = nested.at(row.first);
+        ids.erase(std::find(ids.begin(), ids.end(), row.second));
+        if (ids.empty()) nested.erase(row.first);
+      }
+    });
+    s21_bench::report("  map<K, vector<V>> erase pair", doomed.size(),
+                      elapsed);
+  }
+  {
+    s21::multimap<std::uint64_t, std::uint32_t> index;
+    double elapsed = s21_bench::seconds([&] {
+      for (const auto &row : rows) index.insert(row.first, row.second);
+    });
+    s21_bench::report("  multimap insert", n, elapsed);
+    elapsed = s21_bench::seconds([&] {
+      for (const auto &row : doomed) {
+        auto range = index.equal_range(row.first);
+        for (auto it = range.first; it != range.second; ++it) sum -= *it;
+      }
+    });
+    s21_bench::report("  multimap scan key", doomed.size(), elapsed);
+    index_bytes = index.memory_usage().total_bytes();
+    elapsed = s21_bench::seconds([&] {
+      for (const auto &row : doomed) index.erase(row.first, row.second);
+    });
+    s21_bench::report("  multimap erase pair", doomed.size(), elapsed);
+  }
+  s21_bench::do_not_optimize(sum);
+
+  std::printf("  memory: map<K, vector<V>> %.1f MiB, multimap %.1f MiB\n",
+              nested_bytes / 1048576.0, index_bytes / 1048576.0);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  run("many rows per key", n, n / 64);
+  run("one or two rows per key", n, n);
+  return 0;
+}
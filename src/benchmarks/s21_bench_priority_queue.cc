@@ -0,0 +1,50 @@
+#include <cstdint>
+#include <vector>
+
+#include "../s21_multiset.h"
+#include "../s21_priority_queue.h"
+#include "s21_bench.h"
+
+// Scheduler-like churn: keep a queue of n random priorities, then repeatedly
+// pop the top and push a new one. priority_queue at arity 2 and 4 versus an
+// s21::multiset whose last element serves as the top.
+template <std::size_t Arity>
+void run_heap(const char *name, const std::vector<std::uint64_t> &keys,
+              std::size_t size) {
+  double elapsed = s21_bench::seconds([&] {
+    s21::priority_queue<std::uint64_t, s21::vector<std::uint64_t>,
+                        std::less<std::uint64_t>, Arity>
+        queue(keys.begin(), keys.begin() + size);
+    for (std::size_t i = size; i < keys.size(); ++i) {
+      s21_bench::do_not_optimize(queue.top());
+      queue.pop();
+      queue.push(keys[i]);
+    }
+  });
+  s21_bench::report(name, keys.size(), elapsed);
+}
+
+int main(int argc, char **argv) {
+  const std::size_t size = s21_bench::arg_size(argc, argv, 1000000);
+  const std::size_t churn = 4000000;
+  std::vector<std::uint64_t> keys(size + churn);
+  for (auto &key : keys) key = s21_bench::rng()();
+  std::printf("queue of %zu, %zu pop+push\n", size, churn);
+
+  run_heap<2>("priority_queue, binary", keys, size);
+  run_heap<4>("priority_queue, 4-ary", keys, size);
+  run_heap<8>("priority_queue, 8-ary", keys, size);
+
+  double elapsed = s21_bench::seconds([&] {
+    s21::multiset<std::uint64_t> queue;
+    for (std::size_t i = 0; i < size; ++i) queue.insert(keys[i]);
+    for (std::size_t i = size; i < keys.size(); ++i) {
+      auto top = --queue.end();
+      s21_bench::do_not_optimize(*top);
+      queue.erase(top);
+      queue.insert(keys[i]);
+    }
+  });
+  s21_bench::report("multiset", keys.size(), elapsed);
+  return 0;
+}
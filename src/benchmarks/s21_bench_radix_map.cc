@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../s21_map.h"
+#include "../s21_radix_map.h"
+#include "s21_bench.h"
+
+// radix_map against s21::map<std::string, V> on URL paths and dotted metric
+// names: memory (including key strings that spill out of the small-string
+// buffer), building, and lookups of present keys.
+namespace {
+std::vector<std::string> url_keys(std::size_t n) {
+  static const char *const kServices[] = {"users", "orders", "payments",
+                                          "inventory", "search"};
+  static const char *const kActions[] = {"profile", "settings", "history",
+                                         "items", "status"};
+  std::vector<std::string> keys;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::uint64_t r = s21_bench::rng()();
+    keys.push_back(std::string("/api/v") + std::to_string(1 + r % 3) + "/" +
+                   kServices[(r >> 8) % 5] + "/" +
+                   std::to_string((r >> 16) % 1000000) + "/" +
+                   kActions[(r >> 40) % 5]);
+  }
+  return keys;
+}
+
+std::vector<std::string> metric_keys(std::size_t n) {
+  static const char *const kGroups[] = {"cpu", "mem", "disk", "net"};
+  static const char *const kFields[] = {"user", "system", "idle", "read",
+                                        "write", "errors"};
+  std::vector<std::string> keys;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::uint64_t r = s21_bench::rng()();
+    keys.push_back(std::string("prod.dc") + std::to_string(r % 4) + ".host" +
+                   std::to_string((r >> 8) % 5000) + "." +
+                   kGroups[(r >> 24) % 4] + "." + kFields[(r >> 32) % 6]);
+  }
+  return keys;
+}
+
+std::size_t heap_bytes(const std::string &key) {
+  return key.capacity() > std::string().capacity() ? key.capacity() + 1 : 0;
+}
+
+void run(const char *set_name, const std::vector<std::string> &keys) {
+  std::printf("%s, %zu keys\n", set_name, keys.size());
+  std::vector<std::string> lookups(keys);
+  std::shuffle(lookups.begin(), lookups.end(), s21_bench::rng());
+  std::vector<std::string> shuffled(lookups);
+
+  s21::map<std::string, std::uint64_t> tree;
+  double elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < keys.size(); ++i) tree.insert(keys[i], i);
+  });
+  s21_bench::report("  map insert", keys.size(), elapsed);
+  std::uint64_t sum = 0;
+  elapsed = s21_bench::seconds([&] {
+    for (const auto &key : lookups) sum += tree.at(key);
+  });
+  s21_bench::report("  map lookup", lookups.size(), elapsed);
+  std::size_t tree_bytes = tree.memory_usage().total_bytes();
+  std::sort(lookups.begin(), lookups.end());
+  lookups.erase(std::unique(lookups.begin(), lookups.end()), lookups.end());
+  for (const auto &key : lookups) tree_bytes += heap_bytes(key);
+
+  s21::radix_map<std::uint64_t> trie;
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < keys.size(); ++i) trie.insert(keys[i], i);
+  });
+  s21_bench::report("  radix_map insert", keys.size(), elapsed);
+  elapsed = s21_bench::seconds([&] {
+    for (const auto &key : shuffled) sum -= trie.at(key);
+  });
+  s21_bench::report("  radix_map lookup", keys.size(), elapsed);
+  s21_bench::do_not_optimize(sum);
+
+  std::printf("  memory: map %.1f MiB, radix_map %.1f MiB\n",
+              tree_bytes / 1048576.0,
+              trie.memory_usage().total_bytes() / 1048576.0);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = s21_bench::arg_size(argc, argv, 500000);
+  run("URL paths", url_keys(n));
+  run("metric names", metric_keys(n));
+  return 0;
+}
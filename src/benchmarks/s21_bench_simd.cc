@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <cstdio>
+
+#include "../s21_array.h"
+#include "../s21_simd.h"
+#include "../s21_vector.h"
+#include "s21_bench.h"
+
+// s21::simd algorithms over s21::vector<T> of n elements (4M by default)
+// for std::int32_t, float and std::uint8_t, 20 passes each under every
+// instruction set the CPU supports, and over an s21::array<float, 64> a
+// million times, where the dispatch overhead shows. find and count look
+// for a value that is not there, so every element is scanned.
+namespace {
+using s21::simd::isa;
+
+const char *isa_name(isa level) {
+  switch (level) {
+    case isa::avx2:
+      return "avx2";
+    case isa::sse2:
+      return "sse2";
+    default:
+      return "scalar";
+  }
+}
+
+template <typename Body>
+void run(const char *type, const char *op, std::size_t n, int repeats,
+         Body body) {
+  for (isa level : {isa::scalar, isa::sse2, isa::avx2}) {
+    if (level > s21::simd::supported_isa()) continue;
+    s21::simd::set_isa(level);
+    double elapsed = s21_bench::seconds([&] {
+      for (int i = 0; i < repeats; ++i) body();
+    });
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s %s %s", type, op, isa_name(level));
+    s21_bench::report(name, n * repeats, elapsed);
+  }
+}
+
+template <typename Container>
+void bench(const char *type, Container &a, Container &b, int repeats) {
+  std::size_t n = a.size();
+  using T = s21::simd::element_of_<Container>;
+  const T missing = static_cast<T>(101);
+  run(type, "find", n, repeats, [&] {
+    s21_bench::do_not_optimize(s21::simd::find(a, missing));
+  });
+  run(type, "count", n, repeats, [&] {
+    s21_bench::do_not_optimize(s21::simd::count(a, missing));
+  });
+  run(type, "min_element", n, repeats, [&] {
+    s21_bench::do_not_optimize(s21::simd::min_element(a));
+  });
+  run(type, "max_element", n, repeats, [&] {
+    s21_bench::do_not_optimize(s21::simd::max_element(a));
+  });
+  run(type, "accumulate", n, repeats, [&] {
+    s21_bench::do_not_optimize(s21::simd::accumulate(a, T()));
+  });
+  run(type, "equal", n, repeats, [&] {
+    s21_bench::do_not_optimize(s21::simd::equal(a, b));
+  });
+  run(type, "fill", n, repeats, [&] {
+    s21::simd::fill(b, static_cast<T>(3));
+    s21_bench::do_not_optimize(b.data());
+  });
+}
+
+template <typename T>
+void bench_vector(const char *type, std::size_t n) {
+  s21::vector<T> a(n);
+  for (std::size_t i = 0; i < n; ++i) a[i] = static_cast<T>(i % 100);
+  s21::vector<T> b(a);
+  bench(type, a, b, 20);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = s21_bench::arg_size(argc, argv, 4 << 20);
+  bench_vector<std::int32_t>("int32", n);
+  bench_vector<float>("float", n);
+  bench_vector<std::uint8_t>("uint8", n);
+
+  s21::array<float, 64> a{};
+  for (std::size_t i = 0; i < a.size(); ++i) a[i] = static_cast<float>(i);
+  s21::array<float, 64> b = a;
+  bench("float[64]", a, b, 1000000);
+  return 0;
+}
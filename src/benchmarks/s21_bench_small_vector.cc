@@ -0,0 +1,62 @@
+#include <cstdio>
+#include <string>
+
+#include "../s21_small_vector.h"
+#include "../s21_static_vector.h"
+#include "../s21_vector.h"
+#include "s21_bench.h"
+
+// Short-lived temporaries of 1 to 16 elements: build one, push_back the
+// elements, read them back, drop it. s21::vector allocates on the first
+// push_back; small_vector<T, 8> stays inline up to 8 elements and spills
+// beyond; static_vector<T, 16> never allocates. Also moves of a small
+// temporary between two variables.
+namespace {
+template <class Vector>
+void temporaries(const char *type, std::size_t count, std::size_t rounds) {
+  long sum = 0;
+  double elapsed = s21_bench::seconds([&] {
+    for (std::size_t r = 0; r < rounds; ++r) {
+      Vector v;
+      for (std::size_t i = 0; i < count; ++i) v.push_back(r + i);
+      for (std::size_t i = 0; i < v.size(); ++i) sum += v[i];
+    }
+  });
+  s21_bench::do_not_optimize(sum);
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s, %zu elements", type, count);
+  s21_bench::report(name, rounds, elapsed);
+}
+
+template <class Vector>
+void moves(const char *type, std::size_t rounds) {
+  Vector a, b;
+  for (int i = 0; i < 4; ++i) a.push_back(i);
+  double elapsed = s21_bench::seconds([&] {
+    for (std::size_t r = 0; r < rounds; ++r) {
+      b = std::move(a);
+      a = std::move(b);
+      s21_bench::do_not_optimize(a.data());
+    }
+  });
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s, 4 elements, move there and back",
+                type);
+  s21_bench::report(name, rounds, elapsed);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t rounds = s21_bench::arg_size(argc, argv, 10000000);
+  for (std::size_t count : {1, 4, 8, 16}) {
+    temporaries<s21::vector<long>>("s21::vector<long>", count, rounds);
+    temporaries<s21::small_vector<long, 8>>("small_vector<long, 8>", count,
+                                            rounds);
+    temporaries<s21::static_vector<long, 16>>("static_vector<long, 16>",
+                                              count, rounds);
+  }
+  moves<s21::vector<long>>("s21::vector<long>", rounds);
+  moves<s21::small_vector<long, 8>>("small_vector<long, 8>", rounds);
+  moves<s21::static_vector<long, 16>>("static_vector<long, 16>", rounds);
+  return 0;
+}
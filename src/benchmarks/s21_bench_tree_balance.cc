@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../s21_set.h"
+#include "s21_bench.h"
+
+// Balancing policies side by side on s21::set<uint64_t>: random and
+// sequential ingest, lookups of present keys, and erasing every key, with
+// the rotations each policy spent and the height it ended with.
+namespace {
+template <class Balance>
+using stats_set = s21::set<std::uint64_t, std::less<std::uint64_t>,
+                           std::allocator<std::uint64_t>, s21::tree_stats,
+                           Balance>;
+
+template <class Balance>
+void run(const char *policy, const std::vector<std::uint64_t> &random_keys,
+         const std::vector<std::uint64_t> &lookups) {
+  const std::size_t n = random_keys.size();
+  std::printf("%s\n", policy);
+
+  stats_set<Balance> set;
+  double elapsed = s21_bench::seconds([&] {
+    for (std::uint64_t key : random_keys) set.insert(key);
+  });
+  s21_bench::report("  random insert", n, elapsed);
+  std::printf("  %-42s %zu rotations, height %zu\n", "",
+              set.stats().single_rotations + set.stats().double_rotations,
+              set.height());
+
+  std::size_t found = 0;
+  elapsed = s21_bench::seconds([&] {
+    for (std::uint64_t key : lookups) found += set.contains(key);
+  });
+  s21_bench::report("  lookup", lookups.size(), elapsed);
+  s21_bench::do_not_optimize(found);
+
+  set.stats().reset();
+  elapsed = s21_bench::seconds([&] {
+    for (std::uint64_t key : lookups) set.erase(key);
+  });
+  s21_bench::report("  erase", lookups.size(), elapsed);
+  std::printf("  %-42s %zu rotations\n", "",
+              set.stats().single_rotations + set.stats().double_rotations);
+
+  stats_set<Balance> sorted;
+  elapsed = s21_bench::seconds([&] {
+    for (std::uint64_t key = 0; key < n; ++key) sorted.insert(key);
+  });
+  s21_bench::report("  sequential insert", n, elapsed);
+  std::printf("  %-42s %zu rotations, height %zu\n", "",
+              sorted.stats().single_rotations +
+                  sorted.stats().double_rotations,
+              sorted.height());
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  std::vector<std::uint64_t> keys(n);
+  for (auto &key : keys) key = s21_bench::rng()();
+  std::vector<std::uint64_t> lookups(keys);
+  std::shuffle(lookups.begin(), lookups.end(), s21_bench::rng());
+
+  run<s21::avl_balance>("avl_balance", keys, lookups);
+  run<s21::red_black_balance>("red_black_balance", keys, lookups);
+  run<s21::weight_balance>("weight_balance", keys, lookups);
+  return 0;
+}
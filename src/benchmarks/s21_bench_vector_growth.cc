@@ -0,0 +1,75 @@
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "../s21_vector.h"
+#include "s21_bench.h"
+
+// push_back of n ints (100M by default) under each growth policy, once
+// through realloc (int is trivially relocatable) and once through a fresh
+// buffer and an element-wise move (the same int declared not relocatable).
+// Each run forks, so the peak resident memory it reports is its own.
+namespace {
+struct moved_int {
+  int value;
+};
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<moved_int> : std::false_type {};
+
+namespace {
+template <class T, class Growth>
+void grow(std::size_t n) {
+  s21::vector<T, std::allocator<T>, Growth> v;
+  std::size_t growths = 0;
+  double longest = 0;
+  double elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      if (v.size() < v.capacity()) {
+        v.push_back(T{static_cast<int>(i)});
+        continue;
+      }
+      ++growths;
+      double pause = s21_bench::seconds([&] {
+        v.push_back(T{static_cast<int>(i)});
+      });
+      if (pause > longest) longest = pause;
+    }
+  });
+  s21_bench::do_not_optimize(v.data());
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  std::printf("%9.3f s %4zu growths %8.1f ms longest %7ld MiB peak, ",
+              elapsed, growths, longest * 1e3, usage.ru_maxrss / 1024);
+  std::printf("capacity %zu\n", v.capacity());
+}
+
+template <class T, class Growth>
+void run(const char *name, std::size_t n) {
+  std::printf("%-28s", name);
+  std::fflush(stdout);
+  pid_t child = fork();
+  if (child == 0) {
+    grow<T, Growth>(n);
+    std::fflush(stdout);
+    _exit(0);
+  }
+  waitpid(child, nullptr, 0);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = s21_bench::arg_size(argc, argv, 100000000);
+  std::printf("%zu push_backs of 4-byte elements\n", n);
+  run<int, s21::doubling_growth>("2x, realloc", n);
+  run<int, s21::one_and_half_growth>("1.5x, realloc", n);
+  run<int, s21::size_class_growth>("size classes, realloc", n);
+  run<moved_int, s21::doubling_growth>("2x, new buffer", n);
+  run<moved_int, s21::one_and_half_growth>("1.5x, new buffer", n);
+  run<moved_int, s21::size_class_growth>("size classes, new buffer", n);
+  return 0;
+}
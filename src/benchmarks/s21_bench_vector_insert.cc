@@ -0,0 +1,64 @@
+#include <cstdio>
+#include <string>
+
+#include "../s21_vector.h"
+#include "s21_bench.h"
+
+// Inserting 16 elements into the middle of a vector and erasing them again,
+// once element by element (every call moves the tail, as insert_many used
+// to) and once as a range that moves the tail a single time, for vectors of
+// 1K up to the size given on the command line (1M by default). Throughput
+// counts vector elements per round, so equal sizes compare directly.
+namespace {
+constexpr std::size_t kBatch = 16;
+
+template <class T>
+T make(std::size_t i) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    return std::to_string(i);
+  } else {
+    return static_cast<T>(i);
+  }
+}
+
+template <class T>
+void run(const char *type, std::size_t n) {
+  s21::vector<T> v;
+  for (std::size_t i = 0; i < n; ++i) v.push_back(make<T>(i));
+  s21::vector<T> batch;
+  for (std::size_t i = 0; i < kBatch; ++i) batch.push_back(make<T>(i));
+  v.reserve(n + kBatch);
+  const std::size_t rounds = 30000000 / n + 1;
+  char name[64];
+
+  double elapsed = s21_bench::seconds([&] {
+    for (std::size_t r = 0; r < rounds; ++r) {
+      for (std::size_t i = 0; i < kBatch; ++i) {
+        v.insert(v.begin() + n / 2 + i, batch[i]);
+      }
+      for (std::size_t i = 0; i < kBatch; ++i) v.erase(v.begin() + n / 2);
+    }
+  });
+  std::snprintf(name, sizeof(name), "%s %zu one by one", type, n);
+  s21_bench::report(name, rounds * n, elapsed);
+
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t r = 0; r < rounds; ++r) {
+      v.insert(v.begin() + n / 2, batch.begin(), batch.end());
+      v.erase(v.begin() + n / 2, v.begin() + n / 2 + kBatch);
+    }
+  });
+  std::snprintf(name, sizeof(name), "%s %zu range", type, n);
+  s21_bench::report(name, rounds * n, elapsed);
+  s21_bench::do_not_optimize(v.data());
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t largest = s21_bench::arg_size(argc, argv, 1000000);
+  for (std::size_t n = 1000; n <= largest; n *= 10) run<int>("int", n);
+  for (std::size_t n = 1000; n <= largest; n *= 10) {
+    run<std::string>("string", n);
+  }
+  return 0;
+}
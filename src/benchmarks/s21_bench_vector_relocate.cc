@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "../s21_vector.h"
+#include "s21_bench.h"
+
+// Bulk relocation in s21::vector: growing by push_back (every reallocation
+// moves the whole buffer), copying, and inserting and erasing at the front
+// (each moves the whole tail), from 1K up to the size given on the command
+// line (100M by default) for int, and up to a tenth of it for a 32-byte
+// record and for a type owning a heap int, once declared trivially
+// relocatable and once not.
+namespace {
+struct record {
+  std::uint64_t id;
+  double price;
+  std::uint32_t quantity;
+  std::uint32_t flags;
+  std::uint64_t timestamp;
+};
+
+template <bool kRelocatable>
+struct owner {
+  std::unique_ptr<int> value;
+};
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<owner<true>> : std::true_type {};
+
+namespace {
+template <class T>
+T make(std::size_t i) {
+  T value{};
+  reinterpret_cast<std::uint32_t &>(value) = static_cast<std::uint32_t>(i);
+  return value;
+}
+
+template <>
+owner<true> make(std::size_t) {
+  return {std::make_unique<int>(1)};
+}
+
+template <>
+owner<false> make(std::size_t) {
+  return {std::make_unique<int>(1)};
+}
+
+template <class T>
+void copy(const char *type, std::size_t n, const s21::vector<T> &grown) {
+  char name[64];
+  double elapsed = s21_bench::seconds([&] {
+    s21::vector<T> copy(grown);
+    s21_bench::do_not_optimize(copy.data());
+  });
+  std::snprintf(name, sizeof(name), "%s %zu copy", type, n);
+  s21_bench::report(name, n, elapsed);
+}
+
+// owner is move-only
+template <bool kRelocatable>
+void copy(const char *, std::size_t,
+          const s21::vector<owner<kRelocatable>> &) {}
+
+template <class T>
+void run(const char *type, std::size_t n) {
+  char name[64];
+  s21::vector<T> grown;
+  double elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < n; ++i) grown.push_back(make<T>(i));
+  });
+  std::snprintf(name, sizeof(name), "%s %zu push_back", type, n);
+  s21_bench::report(name, n, elapsed);
+
+  copy(type, n, grown);
+
+  const std::size_t edits = 8;
+  elapsed = s21_bench::seconds([&] {
+    for (std::size_t i = 0; i < edits; ++i) {
+      grown.insert(grown.begin(), make<T>(i));
+      grown.erase(grown.begin());
+    }
+  });
+  std::snprintf(name, sizeof(name), "%s %zu front insert+erase", type, n);
+  s21_bench::report(name, 2 * edits * n, elapsed);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t largest = s21_bench::arg_size(argc, argv, 100000000);
+  for (std::size_t n = 1000; n <= largest; n *= 10) run<int>("int", n);
+  for (std::size_t n = 1000; n <= largest / 10; n *= 10) {
+    run<record>("record", n);
+  }
+  for (std::size_t n = 1000; n <= largest / 10; n *= 10) {
+    run<owner<true>>("owner, relocatable", n);
+    run<owner<false>>("owner", n);
+  }
+  return 0;
+}
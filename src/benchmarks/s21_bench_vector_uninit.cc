@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <cstring>
+
+#include "../s21_vector.h"
+#include "s21_bench.h"
+
+// A read buffer reused for 16 reads of n bytes (64 MiB by default): after
+// clear() it is sized with resize (which zeroes every byte first) or
+// resize_uninitialized, or grown in 64 KiB chunks with resize or
+// append_uninitialized. A memcpy from a source block stands in for read().
+namespace {
+constexpr std::size_t kChunk = 64 * 1024;
+constexpr int kReads = 16;
+
+template <typename Fill>
+void run(const char *name, std::size_t n, Fill fill) {
+  s21::vector<char> buffer;
+  fill(buffer);  // the first read faults the pages in
+  double elapsed = s21_bench::seconds([&] {
+    for (int i = 0; i < kReads; ++i) {
+      buffer.clear();
+      fill(buffer);
+      s21_bench::do_not_optimize(buffer.data());
+    }
+  });
+  s21_bench::report(name, n * kReads, elapsed);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n =
+      s21_bench::arg_size(argc, argv, std::size_t(64) << 20) / kChunk * kChunk;
+  static char source[kChunk];
+  std::memset(source, 'x', sizeof(source));
+  std::printf("%d reads of %zu bytes into a vector<char>\n", kReads, n);
+
+  auto read_all = [&](char *to) {
+    for (std::size_t i = 0; i < n; i += kChunk) {
+      std::memcpy(to + i, source, kChunk);
+    }
+  };
+  run("resize(n) + read", n, [&](s21::vector<char> &buffer) {
+    buffer.resize(n);
+    read_all(buffer.data());
+  });
+  run("resize_uninitialized(n) + read", n, [&](s21::vector<char> &buffer) {
+    buffer.resize_uninitialized(n);
+    read_all(buffer.data());
+  });
+  run("chunked resize + read", n, [&](s21::vector<char> &buffer) {
+    for (std::size_t i = 0; i < n; i += kChunk) {
+      buffer.resize(buffer.size() + kChunk);
+      std::memcpy(buffer.end() - kChunk, source, kChunk);
+    }
+  });
+  run("chunked append_uninitialized + read", n,
+      [&](s21::vector<char> &buffer) {
+        for (std::size_t i = 0; i < n; i += kChunk) {
+          std::memcpy(buffer.append_uninitialized(kChunk), source, kChunk);
+        }
+      });
+  return 0;
+}
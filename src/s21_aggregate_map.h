@@ -0,0 +1,255 @@
+#ifndef S21_AGGREGATE_MAP_H_
+#define S21_AGGREGATE_MAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_binary_tree.h"
+#include "s21_memory.h"
+
+namespace s21 {
+// Monoids for aggregate_map: an associative operator() with an identity().
+// The operator need not be commutative; ranges are combined in key order.
+template <class T>
+struct sum_monoid {
+  T identity() const { return T(); }
+  T operator()(const T &lhs, const T &rhs) const { return lhs + rhs; }
+};
+
+template <class T>
+struct min_monoid {
+  T identity() const { return std::numeric_limits<T>::max(); }
+  T operator()(const T &lhs, const T &rhs) const {
+    return rhs < lhs ? rhs : lhs;
+  }
+};
+
+template <class T>
+struct max_monoid {
+  T identity() const { return std::numeric_limits<T>::lowest(); }
+  T operator()(const T &lhs, const T &rhs) const {
+    return lhs < rhs ? rhs : lhs;
+  }
+};
+
+// Mapped value of an aggregate_map node, plus the aggregate of its subtree
+template <class T>
+struct aggregate_payload {
+  T value;
+  T total;
+
+  aggregate_payload(const T &v = T()) : value{v}, total{v} {}
+};
+
+template <class T, class Monoid>
+struct aggregate_update {
+  template <typename Node>
+  void operator()(Node *node) const noexcept {
+    Monoid op;
+    node->value.total = node->value.value;
+    if (node->left) {
+      node->value.total = op(node->left->value.total, node->value.total);
+    }
+    if (node->right) {
+      node->value.total = op(node->value.total, node->right->value.total);
+    }
+  }
+};
+
+// Ordered map that keeps the Monoid aggregate of every subtree, so the
+// aggregate over any key range takes O(log n). Values are read-only through
+// iterators; change them with insert_or_assign() or accumulate() so the
+// aggregates on the path to the root follow.
+template <class Key, class T, class Monoid = sum_monoid<T>,
+          class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>,
+          class Balance = avl_balance>
+class aggregate_map
+    : public BinaryTree<Key, aggregate_payload<T>, Compare, Allocator,
+                        tree_stats_disabled, aggregate_update<T, Monoid>,
+                        Balance> {
+  using tree_type =
+      BinaryTree<Key, aggregate_payload<T>, Compare, Allocator,
+                 tree_stats_disabled, aggregate_update<T, Monoid>, Balance>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+  using Node = typename tree_type::Node;
+
+  class Iterator;
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  aggregate_map() = default;
+
+  aggregate_map(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item.first, item.second);
+  }
+
+  std::pair<iterator, bool> insert(const Key &key, const T &value) {
+    Node *found = this->find_by_key(key);
+    if (found) return std::make_pair(Iterator(this, found), false);
+    found = this->insert_by_key(key, aggregate_payload<T>(value));
+    if (!found) found = this->fake_;  // LCOV_EXCL_LINE
+    return std::make_pair(Iterator(this, found), found != this->fake_);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &value) {
+    auto result = insert(key, value);
+    if (!result.second) assign(result.first.elem_, value);
+    return result;
+  }
+
+  // Combines value into the one stored under key (inserting it when absent),
+  // e.g. adds to a counter with sum_monoid
+  iterator accumulate(const Key &key, const T &value) {
+    auto result = insert(key, value);
+    if (!result.second) {
+      Node *node = result.first.elem_;
+      assign(node, Monoid()(node->value.value, value));
+    }
+    return result.first;
+  }
+
+  const T &at(const Key &key) const {
+    Node *found = this->find_by_key(key);
+    if (!found) throw std::out_of_range("key not found");
+    return found->value.value;
+  }
+
+  iterator find(const Key &key) const {
+    Node *found = this->find_by_key(key);
+    return Iterator(this, found ? found : this->fake_);
+  }
+
+  void erase(iterator pos) { this->remove_node(pos.elem_); }
+
+  size_type erase(const key_type &key) override {
+    return tree_type::erase(key);
+  }
+
+  // Aggregate of all values, identity() when empty
+  T aggregate() const {
+    return this->root_ ? this->root_->value.total : Monoid().identity();
+  }
+
+  // Aggregate of the values with keys in [lower, upper), in key order
+  T aggregate(const Key &lower, const Key &upper) const {
+    Compare less;
+    Monoid op;
+    Node *split = this->root_;
+    while (split) {
+      if (less(split->key, lower)) {
+        split = split->right;
+      } else if (!less(split->key, upper)) {
+        split = split->left;
+      } else {
+        break;
+      }
+    }
+    if (!split) return op.identity();
+
+    // keys >= lower in the left subtree, collected from the top down, i.e.
+    // from the largest key down
+    T head = op.identity();
+    for (Node *node = split->left; node;) {
+      if (less(node->key, lower)) {
+        node = node->right;
+      } else {
+        T part = node->right ? op(node->value.value, node->right->value.total)
+                             : node->value.value;
+        head = op(part, head);
+        node = node->left;
+      }
+    }
+    // keys < upper in the right subtree, from the smallest key up
+    T tail = op.identity();
+    for (Node *node = split->right; node;) {
+      if (!less(node->key, upper)) {
+        node = node->left;
+      } else {
+        T part = node->left ? op(node->left->value.total, node->value.value)
+                            : node->value.value;
+        tail = op(tail, part);
+        node = node->right;
+      }
+    }
+    return op(op(head, split->value.value), tail);
+  }
+
+  iterator begin() const { return Iterator(this, this->get_begin()); }
+
+  iterator end() const { return Iterator(this, this->fake_); }
+
+  memory_report memory_usage() const {
+    return tree_type::memory_usage(sizeof(Key) + sizeof(T));
+  }
+
+  class Iterator {
+    friend class aggregate_map;
+
+    const aggregate_map *map_ = nullptr;
+    Node *elem_ = nullptr;
+
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = mapped_type;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    Iterator() = default;
+
+    Iterator(const aggregate_map *map, Node *elem) : map_{map}, elem_{elem} {}
+
+    const Key &key() const { return elem_->key; }
+
+    reference operator*() const { return elem_->value.value; }
+
+    pointer operator->() const { return &(elem_->value.value); }
+
+    bool operator==(const Iterator &it) const { return elem_ == it.elem_; }
+
+    bool operator!=(const Iterator &it) const { return elem_ != it.elem_; }
+
+    Iterator &operator++() {
+      elem_ = map_->increment_node(elem_);
+      return *this;
+    }
+
+    Iterator &operator--() {
+      elem_ = map_->decrement_node(elem_);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    Iterator operator--(int) {
+      Iterator tmp = *this;
+      operator--();
+      return tmp;
+    }
+  };
+
+ private:
+  void assign(Node *node, const T &value) {
+    node->value.value = value;
+    this->update_path(node);
+  }
+};
+}  // namespace s21
+
+#endif
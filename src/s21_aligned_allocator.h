@@ -0,0 +1,60 @@
+#ifndef S21_ALIGNED_ALLOCATOR_H_
+#define S21_ALIGNED_ALLOCATOR_H_
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+// Allocator whose blocks start on an Alignment-byte boundary (at least
+// alignof(T)), e.g. 32 or 64 for buffers read with SIMD loads or kept on
+// their own cache lines: s21::vector<float, aligned_allocator<float, 64>>.
+// Stateless, so all instances compare equal.
+template <typename T, std::size_t Alignment = 64>
+class aligned_allocator {
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "aligned_allocator: Alignment must be a power of two");
+
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  static constexpr std::size_t kAlignment =
+      Alignment < alignof(T) ? alignof(T) : Alignment;
+
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  aligned_allocator() noexcept = default;
+
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t(kAlignment)));
+  }
+
+  void deallocate(T *p, std::size_t) noexcept {
+    ::operator delete(p, std::align_val_t(kAlignment));
+  }
+
+  template <typename U>
+  bool operator==(const aligned_allocator<U, Alignment> &) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const aligned_allocator<U, Alignment> &) const noexcept {
+    return false;
+  }
+};
+}  // namespace s21
+
+#endif
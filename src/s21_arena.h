@@ -0,0 +1,151 @@
+#ifndef S21_ARENA_H_
+#define S21_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+// Monotonic memory pool: memory is carved out of large blocks and only given
+// back, all at once, when the arena is destroyed. Not thread-safe.
+class arena {
+ public:
+  static constexpr std::size_t kDefaultBlockSize = 64 * 1024;
+
+  explicit arena(std::size_t block_size = kDefaultBlockSize) noexcept
+      : block_size_{block_size} {}
+
+  arena(const arena &) = delete;
+  arena &operator=(const arena &) = delete;
+
+  ~arena() {
+    while (blocks_) {
+      block *next = blocks_->next;
+      ::operator delete(blocks_);
+      blocks_ = next;
+    }
+  }
+
+  void *allocate(std::size_t bytes, std::size_t alignment) {
+    std::uintptr_t start = (cursor_ + alignment - 1) & ~(alignment - 1);
+    if (!blocks_ || start + bytes > end_) {
+      grow(bytes + alignment);
+      start = (cursor_ + alignment - 1) & ~(alignment - 1);
+    }
+    cursor_ = start + bytes;
+    return reinterpret_cast<void *>(start);
+  }
+
+  // bytes obtained from the system, including the block headers
+  std::size_t reserved() const noexcept { return reserved_; }
+
+ private:
+  struct block {
+    block *next;
+  };
+
+  std::size_t block_size_;
+  std::size_t reserved_ = 0;
+  block *blocks_ = nullptr;
+  std::uintptr_t cursor_ = 0;
+  std::uintptr_t end_ = 0;
+
+  void grow(std::size_t min_bytes) {
+    std::size_t size = sizeof(block) + min_bytes;
+    if (size < block_size_) size = block_size_;
+    block *fresh = static_cast<block *>(::operator new(size));
+    fresh->next = blocks_;
+    blocks_ = fresh;
+    reserved_ += size;
+    cursor_ = reinterpret_cast<std::uintptr_t>(fresh + 1);
+    end_ = reinterpret_cast<std::uintptr_t>(fresh) + size;
+  }
+};
+
+// Allocator drawing from a shared arena. deallocate() is a no-op; the arena
+// is released when the last allocator referring to it goes away. A
+// default-constructed allocator creates its arena on first use, so every
+// container gets its own; one given an arena keeps using it.
+template <typename T>
+class arena_allocator {
+  template <typename U>
+  friend class arena_allocator;
+
+  std::shared_ptr<arena> arena_;
+  bool owns_arena_ = true;
+
+ public:
+  using value_type = T;
+  using is_arena = std::true_type;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  arena_allocator() noexcept = default;
+
+  explicit arena_allocator(std::shared_ptr<arena> source) noexcept
+      : arena_{std::move(source)}, owns_arena_{false} {}
+
+  template <typename U>
+  arena_allocator(const arena_allocator<U> &other) noexcept
+      : arena_{other.arena_}, owns_arena_{other.owns_arena_} {}
+
+  T *allocate(std::size_t n) {
+    if (!arena_) arena_ = std::make_shared<arena>();
+    return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *, std::size_t) noexcept {}
+
+  const std::shared_ptr<arena> &resource() const noexcept { return arena_; }
+
+  // Whether the arena was created for this allocator rather than supplied
+  bool owns_arena() const noexcept { return owns_arena_; }
+
+  template <typename U>
+  bool operator==(const arena_allocator<U> &other) const noexcept {
+    return arena_ == other.arena_;
+  }
+
+  template <typename U>
+  bool operator!=(const arena_allocator<U> &other) const noexcept {
+    return arena_ != other.arena_;
+  }
+};
+
+// True for allocators whose deallocate() does nothing and whose memory is
+// released in bulk; containers then skip the per-node teardown of trivially
+// destructible elements. Allocators opt in with a nested
+// `using is_arena = std::true_type;` or by specializing this trait.
+template <class Allocator, class = void>
+struct is_arena_allocator : std::false_type {};
+
+template <class Allocator>
+struct is_arena_allocator<Allocator, std::void_t<typename Allocator::is_arena>>
+    : Allocator::is_arena {};
+
+template <class Allocator, class = void>
+struct has_owns_arena_ : std::false_type {};
+
+template <class Allocator>
+struct has_owns_arena_<Allocator,
+                       std::void_t<decltype(std::declval<const Allocator &>()
+                                                .owns_arena())>>
+    : std::true_type {};
+
+// Allocator a container goes on with after dropping all its nodes at once:
+// a fresh one if alloc's arena is the container's own, which frees that
+// memory, otherwise alloc itself, so the nodes stay on the arena the caller
+// chose
+template <class Allocator>
+Allocator after_bulk_release(const Allocator &alloc) {
+  if constexpr (has_owns_arena_<Allocator>::value) {
+    if (alloc.owns_arena()) return Allocator();
+  }
+  return alloc;
+}
+}  // namespace s21
+
+#endif
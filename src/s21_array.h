@@ -6,6 +6,8 @@
 #include <iterator>
 #include <utility>
 
+#include "s21_memory.h"
+
 namespace s21 {
 template <typename T, std::size_t N>
 struct array_wrapper_ {
@@ -109,6 +111,11 @@ struct array {
   inline constexpr reference back() { return *(end() - 1); }
   inline constexpr const_reference back() const { return *(end() - 1); }
 
+  // elements are stored inline, nothing is allocated
+  constexpr memory_report memory_usage() const noexcept {
+    return memory_report{sizeof(T) * N, 0, 0};
+  }
+
   void fill(const_reference value);
   void swap(array& other) noexcept(std::is_nothrow_swappable_v<T>);
 };
@@ -1,12 +1,37 @@
 #ifndef S21_BINARY_TREE_H_
 #define S21_BINARY_TREE_H_
 
+#include <functional>
+#include <future>
 #include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "s21_arena.h"
+#include "s21_eytzinger.h"
+#include "s21_memory.h"
+#include "s21_snapshot.h"
+#include "s21_tree_balance.h"
+#include "s21_tree_stats.h"
+#include "s21_vector.h"
 
 namespace s21 {
+// Node update policy for augmented trees: called with a node whose children
+// are up to date, after every insertion, rotation and removal, to recompute
+// data the node keeps about its subtree. Must not throw.
+struct tree_update_none {
+  template <typename Node>
+  void operator()(Node *) const noexcept {}
+};
+
 template <typename Key, typename Value, class Compare = std::less<Key>,
-          class Allocator = std::allocator<Key>>
-class BinaryTree {
+          class Allocator = std::allocator<Key>,
+          class Stats = tree_stats_disabled,
+          class NodeUpdate = tree_update_none, class Balance = avl_balance>
+class BinaryTree : private Stats {
+  friend Balance;
+
  protected:
   struct Node;
 
@@ -22,31 +47,42 @@ class BinaryTree {
   using node_allocator_traits = std::allocator_traits<node_allocator_type>;
 
   size_type size_ = 0;
+  size_type node_count_ = 0;
   Node *root_ = nullptr;
+  Node *rightmost_ = nullptr;  // largest key, for appends without a descent
   Node *fake_ = new Node();
   node_allocator_type alloc_;
 
  public:
   BinaryTree() { fake_->parent = fake_; }
 
+  // empty tree whose nodes come from alloc
+  explicit BinaryTree(const allocator_type &alloc) : alloc_(alloc) {
+    fake_->parent = fake_;
+  }
+
   BinaryTree(const BinaryTree &bt) : BinaryTree() { copy_node(bt.root_); }
 
   BinaryTree(BinaryTree &&bt) noexcept : BinaryTree() {
     std::swap(this->size_, bt.size_);
+    std::swap(this->node_count_, bt.node_count_);
     std::swap(this->root_, bt.root_);
+    std::swap(this->rightmost_, bt.rightmost_);
     std::swap(this->fake_, bt.fake_);
     std::swap(this->alloc_, bt.alloc_);
   }
 
   ~BinaryTree() noexcept {
     clear();
-    destroy_node(fake_);
+    delete fake_;
   }
 
   BinaryTree &operator=(BinaryTree &&bt) noexcept {
     if (this != &bt) {
       std::swap(this->size_, bt.size_);
+      std::swap(this->node_count_, bt.node_count_);
       std::swap(this->root_, bt.root_);
+      std::swap(this->rightmost_, bt.rightmost_);
       std::swap(this->fake_, bt.fake_);
       std::swap(this->alloc_, bt.alloc_);
       bt.clear();
@@ -63,69 +99,44 @@ class BinaryTree {
   }
 
  private:
-  unsigned char get_height(Node *elem) const noexcept {
-    return elem ? elem->height : 0;
+  // Recomputes the balancing data and the augmentation of elem from its
+  // children
+  void update(Node *elem) noexcept {
+    Balance::update(elem);
+    NodeUpdate()(elem);
   }
 
-  int balance_factor(Node *elem) const noexcept {
-    return get_height(elem->right) - get_height(elem->left);
-  }
-
-  void set_height(Node *elem) noexcept {
-    unsigned char left = get_height(elem->left);
-    unsigned char right = get_height(elem->right);
-    elem->height = (left > right ? left : right) + 1;
-  }
+  void on_rotation(bool inner) const noexcept { Stats::on_rotation(inner); }
 
+  // Rotations relink nodes rather than move keys and values between them, so
+  // a node keeps its element for life and iterators stay valid. Each returns
+  // the new root of the rotated subtree.
   Node *right_rotate(Node *elem) noexcept {
-    Node *l = elem->left->left;
-    Node *r_r = elem->right;
-    Node *r_l = elem->left->right;
-    std::swap(elem->key, elem->left->key);
-    std::swap(elem->value, elem->left->value);
-    elem->right = elem->left;
-    elem->left = l;
+    Node *pivot = elem->left;
+    elem->left = pivot->right;
     if (elem->left) elem->left->parent = elem;
-    elem->right->left = r_l;
-    if (elem->right->left) elem->right->left->parent = elem->right;
-    elem->right->right = r_r;
-    if (elem->right->right) elem->right->right->parent = elem->right;
+    pivot->parent = elem->parent;
+    replace_child(elem->parent, elem, pivot);
+    pivot->right = elem;
+    elem->parent = pivot;
 
-    set_height(elem->right);
-    set_height(elem);
-    return elem;
+    update(elem);
+    update(pivot);
+    return pivot;
   }
 
   Node *left_rotate(Node *elem) noexcept {
-    Node *r = elem->right->right;
-    Node *l_l = elem->left;
-    Node *l_r = elem->right->left;
-    std::swap(elem->key, elem->right->key);
-    std::swap(elem->value, elem->right->value);
-    elem->left = elem->right;
-    elem->right = r;
+    Node *pivot = elem->right;
+    elem->right = pivot->left;
     if (elem->right) elem->right->parent = elem;
-    elem->left->right = l_r;
-    if (elem->left->right) elem->left->right->parent = elem->left;
-    elem->left->left = l_l;
-    if (elem->left->left) elem->left->left->parent = elem->left;
+    pivot->parent = elem->parent;
+    replace_child(elem->parent, elem, pivot);
+    pivot->left = elem;
+    elem->parent = pivot;
 
-    set_height(elem);
-    set_height(elem->parent);
-    return elem;
-  }
-
-  void balance(Node *elem) {
-    set_height(elem);
-    if (balance_factor(elem) == 2) {
-      if (balance_factor(elem->right) < 0)
-        elem->right = right_rotate(elem->right);
-      left_rotate(elem);
-    }
-    if (balance_factor(elem) == -2) {
-      if (balance_factor(elem->left) > 0) elem->left = left_rotate(elem->left);
-      right_rotate(elem);
-    }
+    update(elem);
+    update(pivot);
+    return pivot;
   }
 
   Node *get_min(Node *elem) const {
@@ -136,44 +147,90 @@ class BinaryTree {
     return elem->right ? get_max(elem->right) : elem;
   }
 
+  // key comparisons, routed through the statistics policy
+  bool less(const key_type &lhs, const key_type &rhs) const {
+    Stats::on_compare();
+    return Compare()(lhs, rhs);
+  }
+
+  bool equal(const key_type &lhs, const key_type &rhs) const {
+    Stats::on_compare();
+    return lhs == rhs;
+  }
+
   Node *find_node(Node *elem, const key_type &key) const {
-    if (!elem || key == elem->key) return elem;
-    if (Compare()(key, elem->key)) {
-      return find_node(elem->left, key);
-    } else {
-      return find_node(elem->right, key);
+    size_type depth = 0;
+    for (; elem && !equal(key, elem->key); ++depth) {
+      elem = less(key, elem->key) ? elem->left : elem->right;
     }
+    Stats::on_descent(depth);
+    return elem;
   }
 
-  Node *insert_node(Node *elem, key_type &key, value_type &value,
-                    Node *parent) {
-    if (!elem) {
-      ++size_;
-      elem = create_node(key, value);
-      elem->parent = parent;
-      if (!root_) {
-        root_ = elem;
-        fake_->left = root_;
-        return root_;
+  // Whether key belongs right before hint (fake_ for the end), i.e. is not
+  // less than prev, the node preceding hint (nullptr if there is none). The
+  // predecessor of the end is rightmost_.
+  bool fits_before(Node *hint, const key_type &key, Node *&prev) const {
+    if (hint != fake_ && !less(key, hint->key)) return false;
+    prev = hint == fake_ ? rightmost_ : decrement_node(hint);
+    if (prev == fake_) prev = nullptr;
+    return !prev || !less(key, prev->key);
+  }
+
+  // Links a new leaf where the descent for key ends, equal keys going
+  // right, then lets the policy rebalance. When key fits right before hint
+  // (fake_ for the end) the leaf goes between hint and its predecessor with
+  // no descent at all; a key not less than the maximum always does.
+  Node *insert_node(key_type &key, value_type &value, Node *hint) {
+    Node *parent = fake_;
+    Node **link = &root_;
+    size_type depth = 0;
+    Node *prev;
+    bool near = fits_before(hint, key, prev) ||
+                (hint != fake_ && fits_before(hint = fake_, key, prev));
+    if (near) {
+      // prev has no right child: it is the maximum of the left subtree of
+      // hint, or the rightmost node when hint is the end
+      if (hint != fake_ && !hint->left) {
+        parent = hint;
+        link = &hint->left;
+      } else if (prev) {
+        parent = prev;
+        link = &prev->right;
       }
-      (Compare()(key, parent->key)) ? parent->left = elem
-                                    : parent->right = elem;
-      return elem;
-    }
-    Node *result = nullptr;
-    if (Compare()(key, elem->key)) {
-      result = insert_node(elem->left, key, value, elem);
     } else {
-      result = insert_node(elem->right, key, value, elem);
+      for (Node *elem = root_; elem; elem = *link, ++depth) {
+        parent = elem;
+        link = less(key, elem->key) ? &elem->left : &elem->right;
+      }
     }
-    balance(elem);
-    return result;
+    Stats::on_descent(depth);
+    Node *elem = create_node(key, value);
+    ++size_;
+    elem->parent = parent;
+    *link = elem;
+    if (parent == fake_) fake_->left = elem;
+    if (!rightmost_ || link == &rightmost_->right) rightmost_ = elem;
+    update(elem);
+    Balance::after_insert(*this, elem);
+    return elem;
   }
 
-  Node *delete_min(Node *elem) {
-    if (!elem->left) return elem->right;
-    elem->left = delete_min(elem->left);
-    balance(elem);
+  // Builds a perfectly balanced subtree of n nodes at the given depth of a
+  // tree with levels levels; next() creates them in ascending key order
+  template <typename Source>
+  Node *build_balanced(size_type n, Source &next, size_type depth,
+                       size_type levels) {
+    if (!n) return nullptr;
+    Node *left = build_balanced(n / 2, next, depth + 1, levels);
+    Node *elem = next();
+    Node *right = build_balanced(n - n / 2 - 1, next, depth + 1, levels);
+    elem->left = left;
+    elem->right = right;
+    if (left) left->parent = elem;
+    if (right) right->parent = elem;
+    Balance::on_build(elem, depth, levels);
+    update(elem);
     return elem;
   }
 
@@ -185,24 +242,63 @@ class BinaryTree {
     }
   }
 
-  void clean_node(Node *elem) {
-    if (elem) {
-      clean_node(elem->left);
-      clean_node(elem->right);
-      destroy_node(elem);
-      --size_;
+  // Nodes of an arena-backed tree need no teardown when they are trivially
+  // destructible: dropping the arena releases them all at once
+  static constexpr bool kBulkRelease =
+      is_arena_allocator<node_allocator_type>::value &&
+      std::is_trivially_destructible<Node>::value;
+
+  // Frees a detached subtree in O(n) time and O(1) stack: a node with a left
+  // child is rotated right until it has none, then freed, and the walk goes
+  // on with its right child
+  static void destroy_tree(Node *elem, node_allocator_type &alloc) noexcept {
+    while (elem) {
+      if (Node *left = elem->left) {
+        elem->left = left->right;
+        left->right = elem;
+        elem = left;
+      } else {
+        Node *right = elem->right;
+        node_allocator_traits::destroy(alloc, elem);
+        node_allocator_traits::deallocate(alloc, elem, 1);
+        elem = right;
+      }
     }
   }
 
+  void detach_all() noexcept {
+    Stats::on_free(node_count_);
+    node_count_ = 0;
+    size_ = 0;
+    root_ = nullptr;
+    fake_->left = nullptr;
+    rightmost_ = nullptr;
+  }
+
   Node *create_node(key_type key, value_type value) {
     Node *node = node_allocator_traits::allocate(alloc_, 1);
     node_allocator_traits::construct(alloc_, node, key, value);
+    Stats::on_allocate();
+    ++node_count_;
     return node;
   }
 
   void destroy_node(Node *elem) {
     node_allocator_traits::destroy(alloc_, elem);
     node_allocator_traits::deallocate(alloc_, elem, 1);
+    Stats::on_free();
+    --node_count_;
+  }
+
+  void replace_child(Node *parent, Node *old_child, Node *new_child) {
+    if (parent == fake_) {
+      root_ = new_child;
+      fake_->left = new_child;
+    } else if (parent->left == old_child) {
+      parent->left = new_child;
+    } else {
+      parent->right = new_child;
+    }
   }
 
   // вспомогательные функции для функций наследников и их итераторов
@@ -211,10 +307,25 @@ class BinaryTree {
     return find_node(this->root_, key);
   }
 
-  Node *insert_by_key(key_type key, value_type value) {
+  // find_by_key that first looks right before hint (nullptr for the end):
+  // with keys arriving in order, or a correct hint, an absent key is known
+  // to be absent after two comparisons
+  Node *find_near(const key_type &key, Node *hint = nullptr) const {
+    Node *prev;
+    if (!hint) hint = fake_;
+    if (fits_before(hint, key, prev)) {
+      return prev && equal(prev->key, key) ? prev : nullptr;
+    }
+    if (hint != fake_ && equal(hint->key, key)) return hint;
+    return find_by_key(key);
+  }
+
+  // hint is the node key is expected to precede, nullptr for the end (see
+  // insert_node); a wrong hint only costs a comparison or two
+  Node *insert_by_key(key_type key, value_type value, Node *hint = nullptr) {
     Node *created;
     try {
-      created = insert_node(root_, key, value, fake_);
+      created = insert_node(key, value, hint ? hint : fake_);
       // LCOV_EXCL_START
     } catch (...) {
       created = nullptr;
@@ -224,93 +335,273 @@ class BinaryTree {
   }
 
   void remove_node(Node *elem) {
-    Node *left = elem->left;
-    Node *right = elem->right;
+    if (elem == rightmost_) {
+      Node *prev = decrement_node(elem);
+      rightmost_ = prev == fake_ ? nullptr : prev;
+    }
     Node *parent = elem->parent;
-    (Compare()(elem->key, parent->key) || parent == fake_)
-        ? parent->left = nullptr
-        : parent->right = nullptr;
-    if (parent == fake_) root_ = nullptr;
+    Node *replace = elem->left ? elem->left : elem->right;
+    Node *rebalance_from = parent;
+    Node *moved_up = replace;
+    if (elem->left && elem->right) {
+      replace = get_min(elem->right);
+      rebalance_from = replace;
+      moved_up = replace->right;
+      std::swap(replace->balance, elem->balance);
+      if (replace->parent != elem) {
+        rebalance_from = replace->parent;
+        replace->parent->left = replace->right;
+        if (replace->right) replace->right->parent = replace->parent;
+        replace->right = elem->right;
+        replace->right->parent = replace;
+      }
+      replace->left = elem->left;
+      replace->left->parent = replace;
+    }
+    if (replace) replace->parent = parent;
+    replace_child(parent, elem, replace);
+    auto removed = elem->balance;
     destroy_node(elem);
     --size_;
-    if (!right && left) {
-      left->parent = parent;
-      parent->left = left;
-      if (parent == fake_) root_ = left;
-    } else if (!left && right) {
-      right->parent = parent;
-      parent->right = right;
-      if (parent == fake_) root_ = right;
-    } else if (left && right) {
-      Node *min = get_min(right);
-      min->right = delete_min(right);
-      min->left = left;
-      min->left->parent = min;
-      min->parent = parent;
-      if (parent == fake_)
-        root_ = min;
-      else
-        (Compare()(min->key, parent->key)) ? parent->left = min
-                                           : parent->right = min;
-      balance(min);
+    Balance::after_erase(*this, moved_up, rebalance_from, removed);
+  }
+
+  // Reapplies NodeUpdate from elem up to the root after its value changed
+  void update_path(Node *elem) {
+    if (std::is_same<NodeUpdate, tree_update_none>::value) return;
+    for (; elem != fake_; elem = elem->parent) NodeUpdate()(elem);
+  }
+
+  // Node holding the k-th smallest element (from 0), nullptr if k >= size()
+  Node *find_by_rank(size_type k) const {
+    static_assert(Balance::kSubtreeSizes,
+                  "rank queries need a policy that keeps subtree sizes");
+    Node *elem = root_;
+    while (elem) {
+      size_type left = Balance::subtree_size(elem->left);
+      if (k == left) break;
+      if (k < left) {
+        elem = elem->left;
+      } else {
+        k -= left + 1;
+        elem = elem->right;
+      }
     }
+    return elem;
   }
 
-  Node *increment_node(Node *elem) {
-    if (elem->right) {
-      return get_min(elem->right);
-    } else {
-      if (elem->parent->left == elem) return elem->parent;
-      if (elem->parent->parent && elem->key < elem->parent->parent->key)
-        return elem->parent->parent;
-      return fake_;
+  // Number of elements less than key
+  size_type count_less(const key_type &key) const {
+    static_assert(Balance::kSubtreeSizes,
+                  "rank queries need a policy that keeps subtree sizes");
+    size_type rank = 0;
+    for (Node *elem = root_; elem;) {
+      if (less(elem->key, key)) {
+        rank += Balance::subtree_size(elem->left) + 1;
+        elem = elem->right;
+      } else {
+        elem = elem->left;
+      }
     }
+    return rank;
   }
 
-  Node *decrement_node(Node *elem) {
+  Node *increment_node(Node *elem) const {
+    if (elem->right) return get_min(elem->right);
+    Node *parent = elem->parent;
+    while (parent != fake_ && elem == parent->right) {
+      elem = parent;
+      parent = parent->parent;
+    }
+    return parent;
+  }
+
+  Node *decrement_node(Node *elem) const {
     if (elem->left) return get_max(elem->left);
-    if (elem->parent->right == elem) return elem->parent;
-    if (elem->parent->parent && elem->key > elem->parent->parent->key)
-      return elem->parent->parent;
-    return fake_;
-  }
-
-  Node *find_lower_bound(const key_type &key) {
-    if (!root_ || key > get_max(root_)->key ||
-        (size_ == 1 && Compare()(root_->key, key)))
-      return nullptr;
-    if (key == root_->key || (size_ == 1 && Compare()(key, root_->key)))
-      return root_;
-    Node *found =
-        get_min((Compare()(key, root_->key)) ? root_->left : root_->right);
-    while (found && Compare()(found->key, key)) {
-      found = increment_node(found);
+    Node *parent = elem->parent;
+    while (parent != fake_ && elem == parent->left) {
+      elem = parent;
+      parent = parent->parent;
+    }
+    return parent;
+  }
+
+  Node *find_lower_bound(const key_type &key) const {
+    Node *elem = root_;
+    Node *found = nullptr;
+    while (elem) {
+      if (less(elem->key, key)) {
+        elem = elem->right;
+      } else {
+        found = elem;
+        elem = elem->left;
+      }
     }
     return found;
   }
 
-  Node *find_upper_bound(const key_type &key) {
-    Node *found = find_lower_bound(key);
-    if (found && found->key == key) return increment_node(found);
+  Node *find_upper_bound(const key_type &key) const {
+    Node *elem = root_;
+    Node *found = nullptr;
+    while (elem) {
+      if (less(key, elem->key)) {
+        found = elem;
+        elem = elem->left;
+      } else {
+        elem = elem->right;
+      }
+    }
     return found;
   }
 
   Node *get_begin() const { return (root_) ? get_min(root_) : fake_; }
 
+  // Every node plus the sentinel; payload_per_node bytes of each node are
+  // element data, the rest (links, height, unused value) is overhead
+  memory_report memory_usage(size_type payload_per_node) const {
+    memory_report report;
+    report.payload_bytes = node_count_ * payload_per_node;
+    report.overhead_bytes =
+        (node_count_ + 1) * sizeof(Node) - report.payload_bytes;
+    report.allocations = node_count_ + 1;
+    return report;
+  }
+
+  // Writes every node to a snapshot file in Eytzinger order (see
+  // snapshot_file); kind set omits the values
+  void save_snapshot(const std::string &path, snapshot_kind kind) const {
+    static_assert(std::is_trivially_copyable_v<key_type> &&
+                      std::is_trivially_copyable_v<value_type>,
+                  "snapshots need trivially copyable keys and values");
+    const bool with_values = kind != snapshot_kind::set;
+    size_type nodes = 0;
+    for (Node *node = get_begin(); node != fake_; node = increment_node(node))
+      ++nodes;
+    s21::vector<key_type> keys(nodes + 1);
+    s21::vector<value_type> values(with_values ? nodes + 1 : 0);
+    size_type slot = eytzinger_first_slot(nodes);
+    for (Node *node = get_begin(); node != fake_; node = increment_node(node)) {
+      keys[slot] = node->key;
+      if (with_values) values[slot] = node->value;
+      slot = eytzinger_next_slot(slot, nodes);
+    }
+    snapshot_file::write(path, kind, nodes, keys.data(), sizeof(key_type),
+                         values.data(), with_values ? sizeof(value_type) : 0);
+  }
+
+  // Replaces the contents with a snapshot file in O(n): the file is mapped,
+  // walked in key order and turned into a balanced tree without a single
+  // comparison.
+  void load_snapshot(const std::string &path, snapshot_kind kind) {
+    static_assert(std::is_trivially_copyable_v<key_type> &&
+                      std::is_trivially_copyable_v<value_type>,
+                  "snapshots need trivially copyable keys and values");
+    const bool with_values = kind != snapshot_kind::set;
+    snapshot_file file(path, kind, sizeof(key_type),
+                       with_values ? sizeof(value_type) : 0);
+    const auto *keys = static_cast<const key_type *>(file.keys());
+    const auto *values = static_cast<const value_type *>(file.values());
+    const size_type nodes = static_cast<size_type>(file.count());
+    size_type slot = eytzinger_first_slot(nodes);
+    auto next = [&]() {
+      Node *elem =
+          create_node(keys[slot], with_values ? values[slot] : value_type());
+      slot = eytzinger_next_slot(slot, nodes);
+      return elem;
+    };
+    clear();
+    size_type levels = 0;
+    for (size_type n = nodes; n; n >>= 1) ++levels;
+    root_ = build_balanced(nodes, next, 0, levels);
+    if (root_) root_->parent = fake_;
+    fake_->left = root_;
+    rightmost_ = root_ ? get_max(root_) : nullptr;
+    size_ = nodes;
+  }
+
+  // Looks up every key of [first, last) and passes the found node (nullptr
+  // when absent) to emit, in input order. Up to kLookupLanes descents advance
+  // one level per round and prefetch their next node, so the cache misses of
+  // independent lookups overlap instead of forming one dependent chain.
+  template <typename KeyIt, typename Emit>
+  void find_nodes(KeyIt first, KeyIt last, Emit &&emit) const {
+    const key_type *keys[kLookupLanes];
+    Node *nodes[kLookupLanes];
+    size_type depths[kLookupLanes];
+    while (first != last) {
+      size_type lanes = 0;
+      for (; lanes < kLookupLanes && first != last; ++lanes, ++first) {
+        keys[lanes] = std::addressof(*first);
+        nodes[lanes] = root_;
+        depths[lanes] = 0;
+      }
+      for (bool active = true; active;) {
+        active = false;
+        for (size_type i = 0; i < lanes; ++i) {
+          Node *elem = nodes[i];
+          if (elem && !equal(*keys[i], elem->key)) {
+            elem = less(*keys[i], elem->key) ? elem->left : elem->right;
+            if (elem) __builtin_prefetch(elem);
+            nodes[i] = elem;
+            ++depths[i];
+            active = true;
+          }
+        }
+      }
+      for (size_type i = 0; i < lanes; ++i) {
+        Stats::on_descent(depths[i]);
+        emit(nodes[i]);
+      }
+    }
+  }
+
+  static constexpr size_type kLookupLanes = 16;
+
   // Общие функции для наследников
  public:
   inline bool empty() const noexcept { return size_ == 0 ? true : false; }
 
   inline size_type size() const noexcept { return size_; }
 
+  // levels in the tree, 0 when empty
+  size_type height() const noexcept { return Balance::height(root_); }
+
+  // counters of the statistics policy; empty for tree_stats_disabled
+  const Stats &stats() const noexcept { return *this; }
+
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   constexpr size_type max_size() const {
     return std::numeric_limits<difference_type>::max() / (3 * sizeof(void *));
   }
 
   void clear() noexcept {
-    if (size_ && root_) clean_node(root_);
-    size_ = 0;
-    root_ = nullptr;
+    if (kBulkRelease) {
+      if (root_) alloc_ = after_bulk_release(alloc_);
+    } else {
+      destroy_tree(root_, alloc_);
+    }
+    detach_all();
+  }
+
+  // Empties the tree at once and frees the detached nodes on a background
+  // thread; the future becomes ready when they are gone. The tree may be
+  // used again right away.
+  [[nodiscard]] std::future<void> clear_async() {
+    auto teardown = [root = root_, alloc = alloc_]() mutable {
+      if (kBulkRelease) {
+        alloc = node_allocator_type();
+      } else {
+        destroy_tree(root, alloc);
+      }
+    };
+    std::future<void> done =
+        std::async(std::launch::async, std::move(teardown));
+    if (is_arena_allocator<node_allocator_type>::value) {
+      alloc_ = after_bulk_release(alloc_);
+    }
+    detach_all();
+    return done;
   }
 
   virtual size_type count(const key_type &key) const {
@@ -322,6 +613,13 @@ class BinaryTree {
     return (found == nullptr) ? false : true;
   }
 
+  // Writes contains(key) for every key of [first, last) to out
+  template <typename KeyIt, typename OutputIt>
+  OutputIt contains_many(KeyIt first, KeyIt last, OutputIt out) const {
+    find_nodes(first, last, [&out](Node *found) { *out++ = found != nullptr; });
+    return out;
+  }
+
   virtual size_type erase(const key_type &key) {
     Node *found = find_node(root_, key);
     if (found != nullptr) {
@@ -333,8 +631,11 @@ class BinaryTree {
 
   void swap(BinaryTree &other) noexcept {
     std::swap(this->size_, other.size_);
+    std::swap(this->node_count_, other.node_count_);
     std::swap(this->root_, other.root_);
+    std::swap(this->rightmost_, other.rightmost_);
     std::swap(this->fake_, other.fake_);
+    std::swap(this->alloc_, other.alloc_);
   }
 
  protected:
@@ -342,11 +643,16 @@ class BinaryTree {
     key_type key;
     value_type value;
     Node *parent, *left, *right;
-    unsigned char height;
+    typename Balance::node_data balance;
 
     explicit Node(const key_type &k = key_type(), value_type v = value_type(),
                   Node *p = nullptr, Node *l = nullptr, Node *r = nullptr)
-        : key{k}, value{v}, parent{p}, left{l}, right{r}, height{1} {}
+        : key{k},
+          value{v},
+          parent{p},
+          left{l},
+          right{r},
+          balance{Balance::kNewNode} {}
   };
 };
 }  // namespace s21
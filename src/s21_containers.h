@@ -3,6 +3,7 @@
 
 #include "s21_list.h"
 #include "s21_map.h"
+#include "s21_priority_queue.h"
 #include "s21_queue.h"
 #include "s21_set.h"
 #include "s21_stack.h"
@@ -1,7 +1,19 @@
 #ifndef S21_CONTAINERSPLUS_H_
 #define S21_CONTAINERSPLUS_H_
 
+#include "s21_aggregate_map.h"
+#include "s21_aligned_allocator.h"
 #include "s21_array.h"
+#include "s21_cow.h"
+#include "s21_frozen.h"
+#include "s21_indexed_heap.h"
+#include "s21_interval_map.h"
+#include "s21_lru_cache.h"
+#include "s21_radix_map.h"
+#include "s21_multimap.h"
 #include "s21_multiset.h"
+#include "s21_simd.h"
+#include "s21_small_vector.h"
+#include "s21_static_vector.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,120 @@
+#ifndef S21_COW_H_
+#define S21_COW_H_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+#include "s21_map.h"
+#include "s21_multiset.h"
+#include "s21_set.h"
+
+namespace s21 {
+// Copy-on-write handle to a container. Copies share one container and only
+// bump a reference count, so a copy is O(1) whatever the size; the first
+// write() through a shared handle deep-copies the container and detaches
+// from the others. The count is atomic: copies may be handed to other
+// threads and read or written there, as long as a single handle is not
+// used by two threads at once.
+//
+// Reads go through operator* and operator->, which give a const container;
+// iterators obtained that way must not be written through. write() may
+// detach, so iterators taken before it refer to the shared copy.
+template <class Container>
+class cow {
+ public:
+  using container_type = Container;
+  using size_type = std::size_t;
+
+  cow() : block_(new block()) {}
+
+  explicit cow(Container data) : block_(new block(std::move(data))) {}
+
+  cow(std::initializer_list<typename Container::value_type> const &items)
+      : block_(new block(items)) {}
+
+  cow(const cow &other) noexcept : block_(other.block_) {
+    if (block_) block_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // The moved-from handle reads as an empty container
+  cow(cow &&other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+
+  cow &operator=(cow other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  ~cow() noexcept { release(); }
+
+  const Container &operator*() const noexcept {
+    return block_ ? block_->data : empty();
+  }
+
+  const Container *operator->() const noexcept { return &**this; }
+
+  // The container for modification, copied first if another handle shares
+  // it
+  Container &write() {
+    if (!block_) {
+      block_ = new block();
+    } else if (block_->refs.load(std::memory_order_acquire) != 1) {
+      block *copy = new block(block_->data);
+      release();
+      block_ = copy;
+    }
+    return block_->data;
+  }
+
+  // Handles sharing the container, this one included; 0 when moved from
+  size_type use_count() const noexcept {
+    return block_ ? block_->refs.load(std::memory_order_acquire) : 0;
+  }
+
+  bool shared() const noexcept { return use_count() > 1; }
+
+  void swap(cow &other) noexcept { std::swap(block_, other.block_); }
+
+ private:
+  struct block {
+    std::atomic<size_type> refs{1};
+    Container data;
+
+    template <class... Args>
+    explicit block(Args &&...args) : data(std::forward<Args>(args)...) {}
+  };
+
+  block *block_;
+
+  static const Container &empty() {
+    static const Container container{};
+    return container;
+  }
+
+  // The last handle to let go deletes the container; acq_rel orders the
+  // writes of every former owner before the destruction
+  void release() noexcept {
+    if (block_ && block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete block_;
+    }
+    block_ = nullptr;
+  }
+};
+
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+using cow_set = cow<set<Key, Compare, Allocator>>;
+
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+using cow_map = cow<map<Key, T, Compare, Allocator>>;
+
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+using cow_multiset = cow<multiset<Key, Compare, Allocator>>;
+}  // namespace s21
+
+#endif
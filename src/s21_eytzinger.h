@@ -0,0 +1,438 @@
+#ifndef S21_EYTZINGER_H_
+#define S21_EYTZINGER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if defined(__SSE2__) && !defined(S21_DISABLE_SIMD)
+#include <emmintrin.h>
+#define S21_EYTZINGER_SIMD 1
+#endif
+
+#include "s21_snapshot.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// In-order walk over the slots of an Eytzinger layout of n keys: slot 0 is
+// padding and the children of slot k are 2k and 2k + 1. Visiting the slots
+// in this order visits the keys in ascending order, which is how sorted data
+// is laid out and iterated.
+inline std::size_t eytzinger_first_slot(std::size_t n) noexcept {
+  std::size_t k = n ? 1 : 0;
+  while (k && 2 * k <= n) k *= 2;
+  return k;
+}
+
+inline std::size_t eytzinger_last_slot(std::size_t n) noexcept {
+  std::size_t k = n ? 1 : 0;
+  while (k && 2 * k + 1 <= n) k = 2 * k + 1;
+  return k;
+}
+
+inline std::size_t eytzinger_next_slot(std::size_t k, std::size_t n) noexcept {
+  if (2 * k + 1 <= n) {
+    k = 2 * k + 1;
+    while (2 * k <= n) k *= 2;
+    return k;
+  }
+  while (k & 1) k >>= 1;
+  return k >> 1;
+}
+
+inline std::size_t eytzinger_prev_slot(std::size_t k, std::size_t n) noexcept {
+  if (k == 0) return eytzinger_last_slot(n);
+  if (2 * k <= n) {
+    k = 2 * k;
+    while (2 * k + 1 <= n) k = 2 * k + 1;
+    return k;
+  }
+  while (k && !(k & 1)) k >>= 1;
+  return k >> 1;
+}
+
+// Read-only sorted index stored in Eytzinger (BFS) order. A lookup touches
+// one contiguous array, never branches on the comparison result and
+// prefetches the descendants four levels ahead. The arrays are immutable and
+// shared between copies; they live either on the heap or in a memory-mapped
+// snapshot file.
+template <typename Key, class Compare = std::less<Key>>
+class EytzingerIndex {
+ protected:
+  using key_type = Key;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  // number of keys sharing one 64-byte cache line
+  static constexpr size_type kPrefetchStride =
+      sizeof(key_type) < 64 ? 64 / sizeof(key_type) : 1;
+
+  std::shared_ptr<const void> storage_;
+  const key_type *keys_ = nullptr;
+  size_type size_ = 0;
+
+  EytzingerIndex() = default;
+
+  // Lays out [first, last), which must be sorted by Compare and free of
+  // equivalent keys. Slots are visited in key order, so the source is read
+  // once, front to back.
+  template <typename InputIt>
+  EytzingerIndex(InputIt first, InputIt last) {
+    size_ = static_cast<size_type>(std::distance(first, last));
+    auto keys = std::make_shared<s21::vector<key_type>>(size_ + 1);
+    for (size_type k = first_slot(); k != 0; k = next_slot(k), ++first) {
+      (*keys)[k] = *first;
+    }
+    keys_ = keys->data();
+    storage_ = std::move(keys);
+  }
+
+  // Points the index at the keys of a mapped snapshot and keeps it alive
+  void attach(std::shared_ptr<const snapshot_file> file) {
+    size_ = static_cast<size_type>(file->count());
+    keys_ = static_cast<const key_type *>(file->keys());
+    storage_ = std::move(file);
+  }
+
+  size_type first_slot() const noexcept { return eytzinger_first_slot(size_); }
+
+  size_type next_slot(size_type k) const noexcept {
+    return eytzinger_next_slot(k, size_);
+  }
+
+  size_type prev_slot(size_type k) const noexcept {
+    return eytzinger_prev_slot(k, size_);
+  }
+
+  // Undoes the trailing right turns of a finished descent: the remaining
+  // prefix ends at the last node where the search went left, which is the
+  // answer. A descent that only went right yields slot 0 (not found).
+  static size_type restore_slot(size_type k) noexcept {
+    return k >> __builtin_ffsll(static_cast<long long>(~k));
+  }
+
+  size_type lower_bound_slot(const key_type &key) const {
+    const key_type *keys = keys_;
+    size_type k = kary_descend(key);
+    while (k <= size_) {
+      __builtin_prefetch(keys + k * kPrefetchStride);
+      k = 2 * k + Compare()(keys[k], key);
+    }
+    return restore_slot(k);
+  }
+
+  size_type upper_bound_slot(const key_type &key) const {
+    const key_type *keys = keys_;
+    size_type k = 1;
+    while (k <= size_) {
+      __builtin_prefetch(keys + k * kPrefetchStride);
+      k = 2 * k + !Compare()(key, keys[k]);
+    }
+    return restore_slot(k);
+  }
+
+  size_type find_slot(const key_type &key) const {
+    size_type k = lower_bound_slot(key);
+    return (k && !Compare()(key, keys_[k])) ? k : 0;
+  }
+
+ private:
+  static constexpr bool kKarySearchable =
+      std::is_integral_v<key_type> && std::is_signed_v<key_type> &&
+      sizeof(key_type) == 4 && std::is_same_v<Compare, std::less<key_type>>;
+
+  // Runs the first levels of the descent 16-ary: the four levels below k
+  // hold 15 keys in four contiguous runs, and the number of them less than
+  // the key is exactly the bit path of four binary steps.
+  size_type kary_descend(const key_type &key) const {
+#ifdef S21_EYTZINGER_SIMD
+    if constexpr (kKarySearchable) {
+      const key_type *keys = keys_;
+      const __m128i needle = _mm_set1_epi32(static_cast<std::int32_t>(key));
+      size_type k = 1;
+      while (8 * k + 7 <= size_) {
+        __builtin_prefetch(keys + 256 * k);
+        const __m128i level3 = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(keys + 4 * k));
+        const __m128i level4_lo = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(keys + 8 * k));
+        const __m128i level4_hi = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(keys + 8 * k + 4));
+        const __m128i less3 = _mm_cmplt_epi32(level3, needle);
+        const __m128i less4 = _mm_packs_epi32(
+            _mm_cmplt_epi32(level4_lo, needle),
+            _mm_cmplt_epi32(level4_hi, needle));
+        size_type rank = (keys[k] < key) + (keys[2 * k] < key) +
+                         (keys[2 * k + 1] < key);
+        rank += __builtin_popcount(
+            _mm_movemask_ps(_mm_castsi128_ps(less3)));
+        rank += __builtin_popcount(_mm_movemask_epi8(less4)) / 2;
+        k = 16 * k + rank;
+      }
+      return k;
+    }
+#endif
+    (void)key;
+    return 1;
+  }
+
+ public:
+  inline bool empty() const noexcept { return size_ == 0; }
+
+  inline size_type size() const noexcept { return size_; }
+
+  bool contains(const key_type &key) const { return find_slot(key) != 0; }
+
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+};
+
+template <typename Key, class Compare = std::less<Key>>
+class eytzinger_set : public EytzingerIndex<Key, Compare> {
+  using Index = EytzingerIndex<Key, Compare>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  class Iterator;
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  eytzinger_set() : Index() {}
+
+  template <typename InputIt>
+  eytzinger_set(InputIt first, InputIt last) : Index(first, last) {}
+
+  // Maps a snapshot written by set::save() or eytzinger_set::save()
+  // read-only. Nothing is deserialized: lookups fault pages in on demand.
+  static eytzinger_set open(const std::string &path, bool verify = true) {
+    static_assert(std::is_trivially_copyable_v<Key>,
+                  "snapshots need trivially copyable keys");
+    eytzinger_set result;
+    result.attach(std::make_shared<const snapshot_file>(
+        path, snapshot_kind::set, sizeof(Key), 0, verify));
+    return result;
+  }
+
+  void save(const std::string &path) const {
+    static_assert(std::is_trivially_copyable_v<Key>,
+                  "snapshots need trivially copyable keys");
+    snapshot_file::write(path, snapshot_kind::set, this->size_, this->keys_,
+                         sizeof(Key), nullptr, 0);
+  }
+
+  iterator find(const key_type &key) const {
+    return Iterator(this, this->find_slot(key));
+  }
+
+  iterator lower_bound(const key_type &key) const {
+    return Iterator(this, this->lower_bound_slot(key));
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    return Iterator(this, this->upper_bound_slot(key));
+  }
+
+  iterator begin() const { return Iterator(this, this->first_slot()); }
+
+  iterator end() const { return Iterator(this, 0); }
+
+  const_iterator cbegin() const { return begin(); }
+
+  const_iterator cend() const { return end(); }
+
+  class Iterator {
+    const eytzinger_set *set_;
+    size_type slot_;
+
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = Key;
+    using pointer = const Key *;
+    using reference = const Key &;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    explicit Iterator(const eytzinger_set *set = nullptr, size_type slot = 0)
+        : set_{set}, slot_{slot} {}
+
+    reference operator*() const { return set_->keys_[slot_]; }
+
+    pointer operator->() const { return &set_->keys_[slot_]; }
+
+    bool operator==(const Iterator &it) const { return slot_ == it.slot_; }
+
+    bool operator!=(const Iterator &it) const { return slot_ != it.slot_; }
+
+    Iterator &operator++() {
+      slot_ = set_->next_slot(slot_);
+      return *this;
+    }
+
+    Iterator &operator--() {
+      slot_ = set_->prev_slot(slot_);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    Iterator operator--(int) {
+      Iterator tmp = *this;
+      operator--();
+      return tmp;
+    }
+  };
+};
+
+template <typename Key, typename T, class Compare = std::less<Key>>
+class eytzinger_map : public EytzingerIndex<Key, Compare> {
+  using Index = EytzingerIndex<Key, Compare>;
+
+  // mapped values live in a parallel array so that the key array stays dense
+  std::shared_ptr<const void> value_storage_;
+  const T *values_ = nullptr;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+
+  class Iterator;
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  eytzinger_map() : Index() {}
+
+  // [first, last) yields key/value pairs sorted by key without duplicates
+  template <typename InputIt>
+  eytzinger_map(InputIt first, InputIt last) {
+    this->size_ = static_cast<size_type>(std::distance(first, last));
+    auto keys = std::make_shared<s21::vector<Key>>(this->size_ + 1);
+    auto values = std::make_shared<s21::vector<T>>(this->size_ + 1);
+    for (size_type k = this->first_slot(); k != 0;
+         k = this->next_slot(k), ++first) {
+      (*keys)[k] = first->first;
+      (*values)[k] = first->second;
+    }
+    this->keys_ = keys->data();
+    this->storage_ = std::move(keys);
+    values_ = values->data();
+    value_storage_ = std::move(values);
+  }
+
+  // Maps a snapshot written by map::save() or eytzinger_map::save()
+  // read-only. Nothing is deserialized: lookups fault pages in on demand.
+  static eytzinger_map open(const std::string &path, bool verify = true) {
+    static_assert(std::is_trivially_copyable_v<Key> &&
+                      std::is_trivially_copyable_v<T>,
+                  "snapshots need trivially copyable keys and values");
+    auto file = std::make_shared<const snapshot_file>(
+        path, snapshot_kind::map, sizeof(Key), sizeof(T), verify);
+    eytzinger_map result;
+    result.values_ = static_cast<const T *>(file->values());
+    result.attach(std::move(file));
+    return result;
+  }
+
+  void save(const std::string &path) const {
+    static_assert(std::is_trivially_copyable_v<Key> &&
+                      std::is_trivially_copyable_v<T>,
+                  "snapshots need trivially copyable keys and values");
+    snapshot_file::write(path, snapshot_kind::map, this->size_, this->keys_,
+                         sizeof(Key), values_, sizeof(T));
+  }
+
+  const T &at(const key_type &key) const {
+    size_type slot = this->find_slot(key);
+    if (!slot) throw std::out_of_range("key not found");
+    return values_[slot];
+  }
+
+  iterator find(const key_type &key) const {
+    return Iterator(this, this->find_slot(key));
+  }
+
+  iterator lower_bound(const key_type &key) const {
+    return Iterator(this, this->lower_bound_slot(key));
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    return Iterator(this, this->upper_bound_slot(key));
+  }
+
+  iterator begin() const { return Iterator(this, this->first_slot()); }
+
+  iterator end() const { return Iterator(this, 0); }
+
+  const_iterator cbegin() const { return begin(); }
+
+  const_iterator cend() const { return end(); }
+
+  class Iterator {
+    const eytzinger_map *map_;
+    size_type slot_;
+
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = const T *;
+    using reference = const T &;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    explicit Iterator(const eytzinger_map *map = nullptr, size_type slot = 0)
+        : map_{map}, slot_{slot} {}
+
+    reference operator*() const { return map_->values_[slot_]; }
+
+    pointer operator->() const { return &map_->values_[slot_]; }
+
+    const key_type &key() const { return map_->keys_[slot_]; }
+
+    bool operator==(const Iterator &it) const { return slot_ == it.slot_; }
+
+    bool operator!=(const Iterator &it) const { return slot_ != it.slot_; }
+
+    Iterator &operator++() {
+      slot_ = map_->next_slot(slot_);
+      return *this;
+    }
+
+    Iterator &operator--() {
+      slot_ = map_->prev_slot(slot_);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    Iterator operator--(int) {
+      Iterator tmp = *this;
+      operator--();
+      return tmp;
+    }
+  };
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,364 @@
+#ifndef S21_FROZEN_H_
+#define S21_FROZEN_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Seeded 64-bit hash used by the perfect hashing of frozen_set and
+// frozen_map. Provided for integers, enums and std::string_view; specialize
+// it with a constexpr operator()(const Key &, std::uint64_t seed) to hash
+// other key types. Keys without one are looked up by binary search.
+template <class Key, class = void>
+struct frozen_hash {};
+
+constexpr std::uint64_t frozen_mix(std::uint64_t x) noexcept {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+template <class Key>
+struct frozen_hash<Key, std::enable_if_t<std::is_integral<Key>::value ||
+                                         std::is_enum<Key>::value>> {
+  constexpr std::uint64_t operator()(const Key &key,
+                                     std::uint64_t seed) const noexcept {
+    return frozen_mix(static_cast<std::uint64_t>(key) +
+                      seed * 0x9e3779b97f4a7c15ULL);
+  }
+};
+
+// FNV-1a over the bytes, started from a seeded basis
+template <>
+struct frozen_hash<std::string_view> {
+  constexpr std::uint64_t operator()(std::string_view key,
+                                     std::uint64_t seed) const noexcept {
+    std::uint64_t hash = 0xcbf29ce484222325ULL ^ frozen_mix(seed);
+    for (char c : key) {
+      hash ^= static_cast<unsigned char>(c);
+      hash *= 0x100000001b3ULL;
+    }
+    return frozen_mix(hash);
+  }
+};
+
+template <class Key, class Hash, class = void>
+struct is_frozen_hashable : std::false_type {};
+
+template <class Key, class Hash>
+struct is_frozen_hashable<
+    Key, Hash,
+    std::void_t<decltype(std::declval<const Hash &>()(
+        std::declval<const Key &>(), std::uint64_t()))>> : std::true_type {};
+
+// Keys of a frozen container, sorted once by Compare at compile time. With
+// at least kMinHashed keys and a Hash that agrees with Compare, a perfect
+// hash into a power-of-two table (hash and displace: every first-level
+// bucket gets the seed that puts its keys into free slots) finds a key with
+// two hashes and one comparison; otherwise lookups are a binary search.
+// The default frozen_hash only agrees with std::less, so a custom Compare
+// hashes only when it comes with its own Hash. Either way iteration is in
+// key order.
+template <class Key, std::size_t N, class Compare, class Hash>
+class frozen_index {
+  static_assert(N > 0, "a frozen container needs at least one key");
+
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+
+  static constexpr size_type kMinHashed = 8;
+  static constexpr bool kHashed =
+      is_frozen_hashable<Key, Hash>::value && N >= kMinHashed &&
+      (std::is_same<Compare, std::less<Key>>::value ||
+       std::is_same<Compare, std::less<>>::value ||
+       !std::is_same<Hash, frozen_hash<Key>>::value);
+
+  constexpr size_type size() const noexcept { return N; }
+
+  constexpr bool empty() const noexcept { return false; }
+
+  constexpr bool contains(const Key &key) const {
+    return index_of(key) != N;
+  }
+
+  constexpr size_type count(const Key &key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+ protected:
+  static constexpr size_type table_size() noexcept {
+    size_type size = 1;
+    while (size < N) size *= 2;
+    return kHashed ? size : 1;
+  }
+
+  static constexpr size_type kTable = table_size();
+  static constexpr size_type kMask = kTable - 1;
+  static constexpr std::uint64_t kMaxSeed = 1 << 16;
+
+  Key keys_[N]{};
+  // per bucket: 0 for none, a seed, or -(slot + 1) for a lone key
+  std::int64_t seeds_[kTable]{};
+  // per slot: 1 + index of its key in keys_, 0 when free
+  size_type slots_[kTable]{};
+
+  template <class Item, class KeyOf>
+  constexpr frozen_index(const Item (&items)[N], KeyOf key_of) {
+    for (size_type i = 0; i < N; ++i) {
+      Key key = key_of(items[i]);
+      size_type j = i;
+      for (; j && Compare()(key, keys_[j - 1]); --j) keys_[j] = keys_[j - 1];
+      keys_[j] = key;
+    }
+    for (size_type i = 1; i < N; ++i) {
+      if (!Compare()(keys_[i - 1], keys_[i])) {
+        throw std::invalid_argument("frozen container: duplicate key");
+      }
+    }
+    if constexpr (kHashed) build_hash();
+  }
+
+  // Position of key in keys_, N when absent
+  constexpr size_type index_of(const Key &key) const {
+    if constexpr (kHashed) {
+      std::int64_t seed = seeds_[Hash()(key, 0) & kMask];
+      size_type slot =
+          seed < 0 ? static_cast<size_type>(-seed - 1)
+                   : Hash()(key, static_cast<std::uint64_t>(seed)) & kMask;
+      size_type index = slots_[slot];
+      return index && !Compare()(keys_[index - 1], key) &&
+                     !Compare()(key, keys_[index - 1])
+                 ? index - 1
+                 : N;
+    } else {
+      size_type first = 0, count = N;
+      while (count) {
+        size_type half = count / 2;
+        if (Compare()(keys_[first + half], key)) {
+          first += half + 1;
+          count -= half + 1;
+        } else {
+          count = half;
+        }
+      }
+      return first != N && !Compare()(key, keys_[first]) ? first : N;
+    }
+  }
+
+ private:
+  // Buckets are placed from the largest down: a multi-key bucket tries
+  // seeds until its keys land in distinct free slots, a lone key takes the
+  // next free slot directly
+  constexpr void build_hash() {
+    size_type bucket_of[N]{};
+    size_type starts[kTable + 1]{};
+    for (size_type i = 0; i < N; ++i) {
+      bucket_of[i] = Hash()(keys_[i], 0) & kMask;
+      ++starts[bucket_of[i] + 1];
+    }
+    size_type largest = 0;
+    for (size_type b = 0; b < kTable; ++b) {
+      if (starts[b + 1] > largest) largest = starts[b + 1];
+      starts[b + 1] += starts[b];
+    }
+    size_type members[N]{};
+    size_type filled[kTable]{};
+    for (size_type i = 0; i < N; ++i) {
+      size_type b = bucket_of[i];
+      members[starts[b] + filled[b]++] = i;
+    }
+    size_type free_slot = 0;
+    for (size_type size = largest; size; --size) {
+      for (size_type b = 0; b < kTable; ++b) {
+        if (starts[b + 1] - starts[b] != size) continue;
+        if (size == 1) {
+          while (slots_[free_slot]) ++free_slot;
+          slots_[free_slot] = members[starts[b]] + 1;
+          seeds_[b] = -static_cast<std::int64_t>(free_slot) - 1;
+        } else {
+          place_bucket(b, members + starts[b], size);
+        }
+      }
+    }
+  }
+
+  constexpr void place_bucket(size_type bucket, const size_type *members,
+                              size_type size) {
+    for (std::uint64_t seed = 1; seed < kMaxSeed; ++seed) {
+      size_type taken[N]{};
+      size_type placed = 0;
+      for (; placed < size; ++placed) {
+        size_type slot = Hash()(keys_[members[placed]], seed) & kMask;
+        bool clash = slots_[slot] != 0;
+        for (size_type k = 0; k < placed && !clash; ++k) {
+          clash = taken[k] == slot;
+        }
+        if (clash) break;
+        taken[placed] = slot;
+      }
+      if (placed == size) {
+        for (size_type k = 0; k < size; ++k) {
+          slots_[taken[k]] = members[k] + 1;
+        }
+        seeds_[bucket] = static_cast<std::int64_t>(seed);
+        return;
+      }
+    }
+    throw std::logic_error("frozen container: no perfect hash found");
+  }
+};
+
+// Immutable set built at compile time; see frozen_index. Usually made with
+// make_frozen_set.
+template <class Key, std::size_t N, class Compare = std::less<Key>,
+          class Hash = frozen_hash<Key>>
+class frozen_set : public frozen_index<Key, N, Compare, Hash> {
+  using index_type = frozen_index<Key, N, Compare, Hash>;
+
+ public:
+  using value_type = Key;
+  using size_type = std::size_t;
+  using const_iterator = const Key *;
+  using iterator = const_iterator;
+
+  constexpr explicit frozen_set(const Key (&keys)[N])
+      : index_type(keys, [](const Key &key) { return key; }) {}
+
+  constexpr const_iterator find(const Key &key) const {
+    return this->keys_ + this->index_of(key);
+  }
+
+  constexpr const_iterator begin() const noexcept { return this->keys_; }
+
+  constexpr const_iterator end() const noexcept { return this->keys_ + N; }
+};
+
+// Immutable map built at compile time; see frozen_index. T must be a
+// literal type with a default constructor. Like s21::map, iterators
+// dereference to the mapped value and give the key through key().
+template <class Key, class T, std::size_t N, class Compare = std::less<Key>,
+          class Hash = frozen_hash<Key>>
+class frozen_map : public frozen_index<Key, N, Compare, Hash> {
+  using index_type = frozen_index<Key, N, Compare, Hash>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using size_type = std::size_t;
+
+  class const_iterator;
+
+  using iterator = const_iterator;
+
+  constexpr explicit frozen_map(const value_type (&items)[N])
+      : index_type(items, [](const value_type &item) { return item.first; }) {
+    for (size_type i = 0; i < N; ++i) {
+      values_[this->index_of(items[i].first)] = items[i].second;
+    }
+  }
+
+  constexpr const T &at(const Key &key) const {
+    size_type index = this->index_of(key);
+    if (index == N) throw std::out_of_range("frozen_map: key not found");
+    return values_[index];
+  }
+
+  constexpr const_iterator find(const Key &key) const {
+    return const_iterator(this, this->index_of(key));
+  }
+
+  constexpr const_iterator begin() const noexcept {
+    return const_iterator(this, 0);
+  }
+
+  constexpr const_iterator end() const noexcept {
+    return const_iterator(this, N);
+  }
+
+  class const_iterator {
+    friend class frozen_map;
+
+    const frozen_map *map_ = nullptr;
+    size_type index_ = 0;
+
+    constexpr const_iterator(const frozen_map *map, size_type index) noexcept
+        : map_{map}, index_{index} {}
+
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = mapped_type;
+    using pointer = const mapped_type *;
+    using reference = const mapped_type &;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    constexpr const_iterator() noexcept = default;
+
+    constexpr const Key &key() const { return map_->keys_[index_]; }
+
+    constexpr reference operator*() const { return map_->values_[index_]; }
+
+    constexpr pointer operator->() const { return &map_->values_[index_]; }
+
+    constexpr bool operator==(const const_iterator &it) const noexcept {
+      return index_ == it.index_;
+    }
+
+    constexpr bool operator!=(const const_iterator &it) const noexcept {
+      return index_ != it.index_;
+    }
+
+    constexpr const_iterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+
+    constexpr const_iterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+
+    constexpr const_iterator operator++(int) noexcept {
+      const_iterator tmp = *this;
+      ++index_;
+      return tmp;
+    }
+
+    constexpr const_iterator operator--(int) noexcept {
+      const_iterator tmp = *this;
+      --index_;
+      return tmp;
+    }
+  };
+
+ private:
+  T values_[N]{};
+};
+
+// constexpr auto kCodes = s21::make_frozen_map<std::string_view, int>(
+//     {{"GET", 1}, {"PUT", 2}});
+template <class Key, class T, class Compare = std::less<Key>,
+          class Hash = frozen_hash<Key>, std::size_t N>
+constexpr frozen_map<Key, T, N, Compare, Hash> make_frozen_map(
+    const std::pair<Key, T> (&items)[N]) {
+  return frozen_map<Key, T, N, Compare, Hash>(items);
+}
+
+template <class Key, class Compare = std::less<Key>,
+          class Hash = frozen_hash<Key>, std::size_t N>
+constexpr frozen_set<Key, N, Compare, Hash> make_frozen_set(
+    const Key (&keys)[N]) {
+  return frozen_set<Key, N, Compare, Hash>(keys);
+}
+}  // namespace s21
+
+#endif
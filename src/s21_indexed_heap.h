@@ -0,0 +1,236 @@
+#ifndef S21_INDEXED_HEAP_H_
+#define S21_INDEXED_HEAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_memory.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Min-heap whose elements can be reprioritized or removed in O(log n)
+// through the handle push() returned. top() is the least element under
+// Compare, so decrease_key() moves an element towards the top, as in
+// Dijkstra and Prim. A handle stays valid until its element is popped or
+// erased; after that it may be handed out again. Elements and handle table
+// both live in s21::vector, without per-element allocations.
+template <typename T, class Compare = std::less<T>, std::size_t Arity = 4>
+class indexed_heap {
+  static_assert(Arity >= 2, "a heap needs at least two children per node");
+
+ public:
+  using value_type = T;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using handle = std::size_t;
+
+ private:
+  static constexpr size_type kAbsent = std::numeric_limits<size_type>::max();
+
+  struct entry {
+    T value;
+    handle id;
+  };
+
+  s21::vector<entry> heap_;
+  // heap position of every handle, kAbsent for free handles
+  s21::vector<size_type> position_;
+  s21::vector<handle> free_;
+  Compare comp_;
+
+ public:
+  indexed_heap() {}
+
+  explicit indexed_heap(const Compare &comp) : comp_(comp) {}
+
+  const_reference top() const { return heap_[0].value; }
+
+  handle top_handle() const { return heap_[0].id; }
+
+  bool empty() const { return heap_.empty(); }
+
+  size_type size() const { return heap_.size(); }
+
+  bool contains(handle id) const {
+    return id < position_.size() && position_[id] != kAbsent;
+  }
+
+  // Current value of a live handle
+  const_reference get(handle id) const { return heap_[locate(id)].value; }
+
+  handle push(const_reference value) { return emplace(value); }
+
+  handle push(value_type &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  handle emplace(Args &&...args) {
+    entry item{T(std::forward<Args>(args)...), acquire_handle()};
+    handle id = item.id;
+    try {
+      heap_.push_back(std::move(item));
+    } catch (...) {
+      release_handle(id);
+      throw;
+    }
+    position_[id] = heap_.size() - 1;
+    sift_up(heap_.size() - 1);
+    return id;
+  }
+
+  void pop() { remove_at(0); }
+
+  // Removes the element of a live handle
+  void erase(handle id) { remove_at(locate(id)); }
+
+  // Lowers the value of a live handle; throws std::invalid_argument if
+  // value would move it away from the top
+  void decrease_key(handle id, const_reference value) {
+    size_type i = locate(id);
+    if (comp_(heap_[i].value, value)) {
+      throw std::invalid_argument("decrease_key: value is greater");
+    }
+    heap_[i].value = value;
+    sift_up(i);
+  }
+
+  // Raises the value of a live handle; throws std::invalid_argument if
+  // value would move it towards the top
+  void increase_key(handle id, const_reference value) {
+    size_type i = locate(id);
+    if (comp_(value, heap_[i].value)) {
+      throw std::invalid_argument("increase_key: value is less");
+    }
+    heap_[i].value = value;
+    sift_down(i);
+  }
+
+  // Sets the value of a live handle in either direction
+  void update(handle id, const_reference value) {
+    size_type i = locate(id);
+    bool up = comp_(value, heap_[i].value);
+    heap_[i].value = value;
+    if (up) {
+      sift_up(i);
+    } else {
+      sift_down(i);
+    }
+  }
+
+  // Makes room for n elements and n handles
+  void reserve(size_type n) {
+    heap_.reserve(n);
+    position_.reserve(n);
+  }
+
+  void clear() {
+    heap_.clear();
+    position_.clear();
+    free_.clear();
+  }
+
+  // The values are payload; handles, positions and spare capacity overhead
+  memory_report memory_usage() const {
+    memory_report report;
+    for (const memory_report &part :
+         {heap_.memory_usage(), position_.memory_usage(),
+          free_.memory_usage()}) {
+      report.overhead_bytes += part.total_bytes();
+      report.allocations += part.allocations;
+    }
+    report.payload_bytes = heap_.size() * sizeof(T);
+    report.overhead_bytes -= report.payload_bytes;
+    return report;
+  }
+
+ private:
+  static size_type parent(size_type i) noexcept { return (i - 1) / Arity; }
+
+  static size_type first_child(size_type i) noexcept { return i * Arity + 1; }
+
+  size_type locate(handle id) const {
+    if (!contains(id)) throw std::out_of_range("indexed_heap: stale handle");
+    return position_[id];
+  }
+
+  handle acquire_handle() {
+    if (!free_.empty()) {
+      handle id = free_[free_.size() - 1];
+      free_.pop_back();
+      return id;
+    }
+    position_.push_back(kAbsent);
+    return position_.size() - 1;
+  }
+
+  // Takes back a handle acquire_handle() just gave out; free_ still has
+  // room for it, so this does not throw
+  void release_handle(handle id) noexcept {
+    if (id + 1 == position_.size()) {
+      position_.pop_back();
+    } else {
+      free_.push_back(id);
+    }
+  }
+
+  void place(size_type i, entry &&item) {
+    position_[item.id] = i;
+    heap_[i] = std::move(item);
+  }
+
+  void remove_at(size_type i) {
+    handle id = heap_[i].id;
+    size_type last = heap_.size() - 1;
+    if (i != last) {
+      entry moved = std::move(heap_[last]);
+      heap_.pop_back();
+      bool up = i && comp_(moved.value, heap_[parent(i)].value);
+      place(i, std::move(moved));
+      if (up) {
+        sift_up(i);
+      } else {
+        sift_down(i);
+      }
+    } else {
+      heap_.pop_back();
+    }
+    position_[id] = kAbsent;
+    free_.push_back(id);
+  }
+
+  void sift_up(size_type i) {
+    if (!i || !comp_(heap_[i].value, heap_[parent(i)].value)) return;
+    entry item = std::move(heap_[i]);
+    do {
+      place(i, std::move(heap_[parent(i)]));
+      i = parent(i);
+    } while (i && comp_(item.value, heap_[parent(i)].value));
+    place(i, std::move(item));
+  }
+
+  void sift_down(size_type i) {
+    const size_type n = heap_.size();
+    size_type child = first_child(i);
+    if (child >= n) return;
+    entry item = std::move(heap_[i]);
+    for (; child < n; child = first_child(i)) {
+      size_type end = child + Arity < n ? child + Arity : n;
+      size_type best = child;
+      for (++child; child < end; ++child) {
+        if (comp_(heap_[child].value, heap_[best].value)) best = child;
+      }
+      if (!comp_(heap_[best].value, item.value)) break;
+      place(i, std::move(heap_[best]));
+      i = best;
+    }
+    place(i, std::move(item));
+  }
+};
+
+}  // namespace s21
+
+#endif
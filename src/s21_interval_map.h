@@ -0,0 +1,258 @@
+#ifndef S21_INTERVAL_MAP_H_
+#define S21_INTERVAL_MAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_binary_tree.h"
+#include "s21_memory.h"
+
+namespace s21 {
+// Mapped value of an interval_map node, plus the largest upper endpoint of
+// the intervals in the node's subtree
+template <class Key, class T>
+struct interval_payload {
+  T value;
+  Key max_upper;
+
+  interval_payload(const T &v = T(), const Key &upper = Key())
+      : value{v}, max_upper{upper} {}
+};
+
+// Orders intervals by lower, then upper endpoint
+template <class Key, class Compare>
+struct interval_less {
+  bool operator()(const std::pair<Key, Key> &lhs,
+                  const std::pair<Key, Key> &rhs) const {
+    Compare less;
+    if (less(lhs.first, rhs.first)) return true;
+    if (less(rhs.first, lhs.first)) return false;
+    return less(lhs.second, rhs.second);
+  }
+};
+
+template <class Key, class Compare>
+struct interval_max_update {
+  template <typename Node>
+  void operator()(Node *node) const noexcept {
+    Compare less;
+    const Key *max = &node->key.second;
+    if (node->left && less(*max, node->left->value.max_upper)) {
+      max = &node->left->value.max_upper;
+    }
+    if (node->right && less(*max, node->right->value.max_upper)) {
+      max = &node->right->value.max_upper;
+    }
+    node->value.max_upper = *max;
+  }
+};
+
+// Map from closed intervals [lower, upper] to values, ordered by lower
+// endpoint. Every node also tracks the largest upper endpoint below it, so
+// stabbing and overlap queries skip the subtrees that cannot match: they
+// visit O(log n) nodes plus the ancestors of the reported intervals.
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator =
+              std::allocator<std::pair<const std::pair<Key, Key>, T>>,
+          class Balance = avl_balance>
+class interval_map
+    : public BinaryTree<std::pair<Key, Key>, interval_payload<Key, T>,
+                        interval_less<Key, Compare>, Allocator,
+                        tree_stats_disabled,
+                        interval_max_update<Key, Compare>, Balance> {
+  using tree_type =
+      BinaryTree<std::pair<Key, Key>, interval_payload<Key, T>,
+                 interval_less<Key, Compare>, Allocator, tree_stats_disabled,
+                 interval_max_update<Key, Compare>, Balance>;
+
+ public:
+  using key_type = Key;
+  using interval_type = std::pair<Key, Key>;
+  using mapped_type = T;
+  using size_type = std::size_t;
+  using Node = typename tree_type::Node;
+
+  class Iterator;
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  interval_map() = default;
+
+  interval_map(
+      std::initializer_list<std::pair<interval_type, mapped_type>> const
+          &items) {
+    for (const auto &item : items) {
+      insert(item.first.first, item.first.second, item.second);
+    }
+  }
+
+  // Throws std::invalid_argument when upper < lower
+  std::pair<iterator, bool> insert(const Key &lower, const Key &upper,
+                                   const T &value) {
+    return add(lower, upper, value, false);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key &lower,
+                                             const Key &upper,
+                                             const T &value) {
+    return add(lower, upper, value, true);
+  }
+
+  iterator find(const Key &lower, const Key &upper) const {
+    Node *found = this->find_by_key(interval_type(lower, upper));
+    return Iterator(this, found ? found : this->fake_);
+  }
+
+  bool contains(const Key &lower, const Key &upper) const {
+    return this->find_by_key(interval_type(lower, upper)) != nullptr;
+  }
+
+  T &at(const Key &lower, const Key &upper) {
+    Node *found = this->find_by_key(interval_type(lower, upper));
+    if (!found) throw std::out_of_range("interval not found");
+    return found->value.value;
+  }
+
+  size_type erase(const Key &lower, const Key &upper) {
+    return tree_type::erase(interval_type(lower, upper));
+  }
+
+  void erase(iterator pos) { this->remove_node(pos.elem_); }
+
+  // Writes an iterator to every interval containing point, in order
+  template <typename OutputIt>
+  OutputIt stab(const Key &point, OutputIt out) const {
+    return overlap(point, point, out);
+  }
+
+  // Writes an iterator to every interval intersecting [lower, upper], in
+  // order
+  template <typename OutputIt>
+  OutputIt overlap(const Key &lower, const Key &upper, OutputIt out) const {
+    collect(this->root_, lower, upper, out);
+    return out;
+  }
+
+  // Whether any interval intersects [lower, upper]; a single descent
+  bool overlaps(const Key &lower, const Key &upper) const {
+    Compare less;
+    Node *node = this->root_;
+    while (node) {
+      if (!less(upper, node->key.first) && !less(node->key.second, lower)) {
+        return true;
+      }
+      if (node->left && !less(node->left->value.max_upper, lower)) {
+        node = node->left;
+      } else {
+        node = node->right;
+      }
+    }
+    return false;
+  }
+
+  iterator begin() const { return Iterator(this, this->get_begin()); }
+
+  iterator end() const { return Iterator(this, this->fake_); }
+
+  memory_report memory_usage() const {
+    return tree_type::memory_usage(2 * sizeof(Key) + sizeof(T));
+  }
+
+  class Iterator {
+    friend class interval_map;
+
+    const interval_map *map_ = nullptr;
+    Node *elem_ = nullptr;
+
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = mapped_type;
+    using pointer = value_type *;
+    using reference = value_type &;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    Iterator() = default;
+
+    Iterator(const interval_map *map, Node *elem) : map_{map}, elem_{elem} {}
+
+    const interval_type &interval() const { return elem_->key; }
+
+    const Key &lower() const { return elem_->key.first; }
+
+    const Key &upper() const { return elem_->key.second; }
+
+    reference operator*() const { return elem_->value.value; }
+
+    pointer operator->() const { return &(elem_->value.value); }
+
+    bool operator==(const Iterator &it) const { return elem_ == it.elem_; }
+
+    bool operator!=(const Iterator &it) const { return elem_ != it.elem_; }
+
+    Iterator &operator++() {
+      elem_ = map_->increment_node(elem_);
+      return *this;
+    }
+
+    Iterator &operator--() {
+      elem_ = map_->decrement_node(elem_);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    Iterator operator--(int) {
+      Iterator tmp = *this;
+      operator--();
+      return tmp;
+    }
+  };
+
+ private:
+  std::pair<iterator, bool> add(const Key &lower, const Key &upper,
+                                const T &value, bool assign) {
+    if (Compare()(upper, lower)) {
+      throw std::invalid_argument("interval upper bound precedes lower bound");
+    }
+    interval_type key(lower, upper);
+    Node *found = this->find_by_key(key);
+    bool inserted = false;
+    if (!found) {
+      found = this->insert_by_key(key, interval_payload<Key, T>(value, upper));
+      if (!found) {
+        found = this->fake_;  // LCOV_EXCL_LINE
+      } else {
+        inserted = true;
+      }
+    } else if (assign) {
+      found->value.value = value;
+    }
+    return std::make_pair(Iterator(this, found), inserted);
+  }
+
+  // In-order walk that skips subtrees whose intervals all end before lower
+  // and stops once intervals start after upper
+  template <typename OutputIt>
+  void collect(Node *node, const Key &lower, const Key &upper,
+               OutputIt &out) const {
+    Compare less;
+    while (node && !less(node->value.max_upper, lower)) {
+      collect(node->left, lower, upper, out);
+      if (less(upper, node->key.first)) return;
+      if (!less(node->key.second, lower)) *out++ = Iterator(this, node);
+      node = node->right;
+    }
+  }
+};
+}  // namespace s21
+
+#endif
@@ -2,9 +2,15 @@
 #define S21_LIST_H_
 
 #include <algorithm>
+#include <future>
 #include <initializer_list>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <utility>
+
+#include "s21_arena.h"
+#include "s21_memory.h"
 
 namespace s21 {
 
@@ -53,6 +59,15 @@ class list {
         size_(0),
         node_allocator_() {}
 
+  // empty list whose nodes come from alloc
+  explicit list(const Allocator &alloc) : list() {
+    node_allocator_ = node_allocator_type(alloc);
+  }
+
+  allocator_type get_allocator() const {
+    return allocator_type(node_allocator_);
+  }
+
   list(const std::initializer_list<T> &items) : list() {
     for (const auto &item : items) {
       push_back(item);
@@ -123,6 +138,15 @@ class list {
 
   [[nodiscard]] constexpr bool empty() const { return size_ == 0; }
 
+  // One node per element; the sentinel lives inside the list object
+  memory_report memory_usage() const {
+    memory_report report;
+    report.payload_bytes = size_ * sizeof(T);
+    report.overhead_bytes = size_ * (sizeof(ListNode) - sizeof(T));
+    report.allocations = size_;
+    return report;
+  }
+
   iterator begin() { return iterator(sentinelNode_.next); }
   iterator end() { return iterator(&sentinelNode_); }
 
@@ -258,10 +282,35 @@ class list {
     return const_cast<T &>(static_cast<const list *>(this)->back());
   }
 
-  constexpr void clear() {
-    while (size_ > 0) {
-      pop_back();
+  // One pass over the nodes without relinking; an arena-backed list of
+  // trivially destructible elements just drops its arena
+  void clear() noexcept {
+    if (kBulkRelease) {
+      if (size_) node_allocator_ = after_bulk_release(node_allocator_);
+    } else {
+      destroy_chain(sentinelNode_.next, size_, node_allocator_);
     }
+    detach_all();
+  }
+
+  // Empties the list at once and frees the detached nodes on a background
+  // thread; the future becomes ready when they are gone
+  [[nodiscard]] std::future<void> clear_async() {
+    auto teardown = [first = sentinelNode_.next, count = size_,
+                     alloc = node_allocator_]() mutable {
+      if (kBulkRelease) {
+        alloc = node_allocator_type();
+      } else {
+        destroy_chain(first, count, alloc);
+      }
+    };
+    std::future<void> done =
+        std::async(std::launch::async, std::move(teardown));
+    if (is_arena_allocator<node_allocator_type>::value) {
+      node_allocator_ = after_bulk_release(node_allocator_);
+    }
+    detach_all();
+    return done;
   }
 
   template <typename U = T>
@@ -269,6 +318,8 @@ class list {
     std::swap(sentinelNode_, other.sentinelNode_);
     std::swap(size_, other.size_);
     std::swap(node_allocator_, other.node_allocator_);
+    relink_sentinel();
+    other.relink_sentinel();
   }
 
   constexpr void merge(list &other) {
@@ -412,6 +463,38 @@ class list {
   }
 
  private:
+  static constexpr bool kBulkRelease =
+      is_arena_allocator<node_allocator_type>::value &&
+      std::is_trivially_destructible<T>::value;
+
+  static void destroy_chain(BaseNode *node, size_type count,
+                            node_allocator_type &alloc) noexcept {
+    for (; count; --count) {
+      BaseNode *next = node->next;
+      node_allocator_traits::destroy(alloc, static_cast<ListNode *>(node));
+      node_allocator_traits::deallocate(alloc, static_cast<ListNode *>(node),
+                                        1);
+      node = next;
+    }
+  }
+
+  void detach_all() noexcept {
+    sentinelNode_.next = &sentinelNode_;
+    sentinelNode_.prev = &sentinelNode_;
+    size_ = 0;
+  }
+
+  // after the sentinel is copied by value, the boundary nodes still point at
+  // its old address
+  void relink_sentinel() noexcept {
+    if (size_) {
+      sentinelNode_.next->prev = &sentinelNode_;
+      sentinelNode_.prev->next = &sentinelNode_;
+    } else {
+      detach_all();
+    }
+  }
+
   template <typename U = T>
   ListNode *create_node(U &&value) {
     ListNode *node = node_allocator_traits::allocate(node_allocator_, 1);
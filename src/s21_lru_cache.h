@@ -0,0 +1,272 @@
+#ifndef S21_LRU_CACHE_H_
+#define S21_LRU_CACHE_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "s21_binary_tree.h"
+#include "s21_memory.h"
+
+namespace s21 {
+enum class lru_policy {
+  // one recency list
+  lru,
+  // segmented LRU: new entries wait in a probation segment and are promoted
+  // to the protected one (80% of the capacity) on their second hit, so a
+  // one-off scan cannot flush the working set
+  segmented
+};
+
+// Default weigher: every entry weighs 1, so the capacity counts entries
+struct lru_unit_weight {
+  template <class Key, class T>
+  std::size_t operator()(const Key &, const T &) const noexcept {
+    return 1;
+  }
+};
+
+// Cached value together with its recency links. The links point at tree
+// nodes, whose type depends on this one, hence void pointers.
+template <class T>
+struct lru_entry {
+  T value;
+  void *prev = nullptr;
+  void *next = nullptr;
+  std::size_t weight = 0;
+  bool hot = false;
+
+  lru_entry(const T &v = T(), std::size_t w = 0) : value{v}, weight{w} {}
+};
+
+// Bounded key-value cache that evicts the least recently used entries. Every
+// entry is a single tree node: the AVL index finds it in O(log n) and the
+// recency list threaded through the nodes is updated in O(1), without any
+// allocation on hits. Capacity is a total weight, by default an entry count.
+template <class Key, class T, class Weigher = lru_unit_weight,
+          class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class lru_cache : private BinaryTree<Key, lru_entry<T>, Compare, Allocator> {
+  using tree_type = BinaryTree<Key, lru_entry<T>, Compare, Allocator>;
+  using Node = typename tree_type::Node;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using size_type = std::size_t;
+  using eviction_callback = std::function<void(const Key &, T &)>;
+
+  explicit lru_cache(size_type capacity, lru_policy policy = lru_policy::lru,
+                     Weigher weigher = Weigher())
+      : capacity_{capacity}, policy_{policy}, weigher_{std::move(weigher)} {}
+
+  lru_cache(const lru_cache &) = delete;
+  lru_cache &operator=(const lru_cache &) = delete;
+
+  lru_cache(lru_cache &&other) noexcept
+      : tree_type(std::move(other)),
+        capacity_{other.capacity_},
+        policy_{other.policy_},
+        weigher_{std::move(other.weigher_)},
+        evict_{std::move(other.evict_)},
+        probation_{other.probation_},
+        protected_{other.protected_},
+        hits_{other.hits_},
+        misses_{other.misses_} {
+    other.probation_ = segment();
+    other.protected_ = segment();
+  }
+
+  ~lru_cache() = default;
+
+  using tree_type::contains;
+  using tree_type::empty;
+  using tree_type::size;
+
+  // Called with every entry pushed out by capacity, before it is destroyed;
+  // not called for erase() and clear()
+  void on_evict(eviction_callback callback) { evict_ = std::move(callback); }
+
+  // Cached value marked as most recently used, nullptr on a miss
+  T *get(const Key &key) {
+    Node *node = this->find_by_key(key);
+    if (!node) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    touch(node);
+    return &node->value.value;
+  }
+
+  // Cached value without touching recency or the hit counters
+  const T *peek(const Key &key) const {
+    Node *node = this->find_by_key(key);
+    return node ? &node->value.value : nullptr;
+  }
+
+  // Inserts or replaces the value, then evicts until the weight fits. An
+  // entry heavier than the whole capacity is not cached and false returned.
+  bool put(const Key &key, const T &value) {
+    size_type weight = weigher_(key, value);
+    Node *node = this->find_by_key(key);
+    if (weight > capacity_) {
+      if (node) remove(node);
+      return false;
+    }
+    if (node) {
+      segment &owner = segment_of(node);
+      owner.weight = owner.weight - node->value.weight + weight;
+      node->value.value = value;
+      node->value.weight = weight;
+      touch(node);
+    } else {
+      node = this->insert_by_key(key, lru_entry<T>(value, weight));
+      if (!node) throw std::bad_alloc();
+      link_front(probation_, node);
+    }
+    shrink_to(capacity_, node);
+    return true;
+  }
+
+  size_type erase(const Key &key) override {
+    Node *node = this->find_by_key(key);
+    if (node) remove(node);
+    return node ? 1 : 0;
+  }
+
+  void clear() noexcept {
+    tree_type::clear();
+    probation_ = segment();
+    protected_ = segment();
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  // Evicts right away when the new capacity is below the current weight
+  void set_capacity(size_type capacity) {
+    capacity_ = capacity;
+    if (policy_ == lru_policy::segmented) demote_overflow(nullptr);
+    shrink_to(capacity_, nullptr);
+  }
+
+  // Sum of the weights of the cached entries
+  size_type weight() const noexcept {
+    return probation_.weight + protected_.weight;
+  }
+
+  size_type hits() const noexcept { return hits_; }
+  size_type misses() const noexcept { return misses_; }
+
+  memory_report memory_usage() const {
+    return tree_type::memory_usage(sizeof(Key) + sizeof(T));
+  }
+
+ private:
+  struct segment {
+    Node *head = nullptr;  // most recently used
+    Node *tail = nullptr;  // least recently used
+    size_type weight = 0;
+  };
+
+  size_type capacity_;
+  lru_policy policy_;
+  Weigher weigher_;
+  eviction_callback evict_;
+  // the only segment under lru_policy::lru
+  segment probation_;
+  segment protected_;
+  size_type hits_ = 0;
+  size_type misses_ = 0;
+
+  static Node *prev_of(Node *node) noexcept {
+    return static_cast<Node *>(node->value.prev);
+  }
+
+  static Node *next_of(Node *node) noexcept {
+    return static_cast<Node *>(node->value.next);
+  }
+
+  segment &segment_of(Node *node) noexcept {
+    return node->value.hot ? protected_ : probation_;
+  }
+
+  size_type protected_capacity() const noexcept {
+    return capacity_ - capacity_ / 5;
+  }
+
+  void link_front(segment &seg, Node *node) noexcept {
+    node->value.prev = nullptr;
+    node->value.next = seg.head;
+    if (seg.head) {
+      seg.head->value.prev = node;
+    } else {
+      seg.tail = node;
+    }
+    seg.head = node;
+    seg.weight += node->value.weight;
+    node->value.hot = &seg == &protected_;
+  }
+
+  void unlink(segment &seg, Node *node) noexcept {
+    Node *prev = prev_of(node);
+    Node *next = next_of(node);
+    if (prev) {
+      prev->value.next = next;
+    } else {
+      seg.head = next;
+    }
+    if (next) {
+      next->value.prev = prev;
+    } else {
+      seg.tail = prev;
+    }
+    seg.weight -= node->value.weight;
+  }
+
+  void touch(Node *node) noexcept {
+    segment &owner = segment_of(node);
+    if (owner.head == node && policy_ == lru_policy::lru) return;
+    unlink(owner, node);
+    if (policy_ == lru_policy::lru) {
+      link_front(probation_, node);
+    } else {
+      link_front(protected_, node);
+      demote_overflow(node);
+    }
+  }
+
+  // Moves protected entries back to probation until the protected segment
+  // fits its share again, never demoting keep
+  void demote_overflow(Node *keep) noexcept {
+    while (protected_.weight > protected_capacity() && protected_.tail &&
+           protected_.tail != keep) {
+      Node *victim = protected_.tail;
+      unlink(protected_, victim);
+      link_front(probation_, victim);
+    }
+  }
+
+  // Evicts from the cold end until the weight fits, sparing keep
+  void shrink_to(size_type limit, Node *keep) {
+    while (weight() > limit) {
+      Node *victim = probation_.tail;
+      if (victim == keep) victim = prev_of(victim);
+      if (!victim) victim = protected_.tail;
+      if (victim == keep) victim = prev_of(victim);
+      if (!victim) break;
+      if (evict_) evict_(victim->key, victim->value.value);
+      remove(victim);
+    }
+  }
+
+  void remove(Node *node) {
+    unlink(segment_of(node), node);
+    this->remove_node(node);
+  }
+};
+}  // namespace s21
+
+#endif
@@ -5,18 +5,25 @@
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "s21_binary_tree.h"
+#include "s21_eytzinger.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
 template <class Key, class T, class Compare = std::less<Key>,
-          class Allocator = std::allocator<std::pair<const Key, T>>>
-class map : public BinaryTree<Key, T, Compare, Allocator> {
+          class Allocator = std::allocator<std::pair<const Key, T>>,
+          class Stats = tree_stats_disabled, class Balance = avl_balance>
+class map : public BinaryTree<Key, T, Compare, Allocator, Stats,
+                              tree_update_none, Balance> {
+  using tree_type = BinaryTree<Key, T, Compare, Allocator, Stats,
+                               tree_update_none, Balance>;
+
   map& ref_ = *this;
 
  public:
@@ -25,31 +32,33 @@ class map : public BinaryTree<Key, T, Compare, Allocator> {
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using Node = typename BinaryTree<Key, T, Compare, Allocator>::Node;
+  using Node = typename tree_type::Node;
   using size_type = std::size_t;
 
-  map() : BinaryTree<Key, T, Compare, Allocator>(){};
+  map() : tree_type(){};
+
+  explicit map(const Allocator& alloc) : tree_type(alloc) {}
 
   explicit map(std::initializer_list<value_type> const& items)
-      : BinaryTree<Key, T, Compare, Allocator>() {
+      : tree_type() {
     for (const auto& item : items) {
       insert(item.first, item.second);
     }
   };
 
-  map(const map& m) : BinaryTree<Key, T, Compare, Allocator>(m){};
+  map(const map& m) : tree_type(m){};
 
-  map(map&& m) : BinaryTree<Key, T, Compare, Allocator>(std::move(m)){};
+  map(map&& m) : tree_type(std::move(m)){};
 
   ~map(){};
 
   map& operator=(map&& m) noexcept {
-    BinaryTree<Key, T, Compare, Allocator>::operator=(std::move(m));
+    tree_type::operator=(std::move(m));
     return *this;
   }
 
   map& operator=(const map& m) noexcept {
-    BinaryTree<Key, T, Compare, Allocator>::operator=(m);
+    tree_type::operator=(m);
     return *this;
   }
 
@@ -65,11 +74,11 @@ class map : public BinaryTree<Key, T, Compare, Allocator> {
   using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   std::pair<iterator, bool> add(const Key& key, const T& obj,
-                                bool assign = false) {
-    Node* found = BinaryTree<Key, T, Compare, Allocator>::find_by_key(key);
+                                bool assign = false, Node* hint = nullptr) {
+    Node* found = tree_type::find_near(key, hint);
     bool inserted = false;
     if (!found) {
-      found = BinaryTree<Key, T, Compare, Allocator>::insert_by_key(key, obj);
+      found = tree_type::insert_by_key(key, obj, hint);
       if (!found) {
         found = this->fake_;  // LCOV_EXCL_LINE
       } else {
@@ -89,20 +98,52 @@ class map : public BinaryTree<Key, T, Compare, Allocator> {
     return add(value.first, value.second, false);
   }
 
+  // Inserts value right before hint in amortized O(1) when it belongs there;
+  // a wrong hint costs a descent from the root, as insert(value) does
+  iterator insert(iterator hint, const value_type& value) {
+    return add(value.first, value.second, false, hint.elem_).first;
+  }
+
   std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
     return add(key, obj, true);
   }
 
   T& at(const Key& key) {
-    Node* found = BinaryTree<Key, T, Compare, Allocator>::find_by_key(key);
+    Node* found = tree_type::find_by_key(key);
     if (!found) throw std::out_of_range("key not found");
     return found->value;
   }
 
+  Iterator find(const Key& key) const {
+    Node* found = tree_type::find_by_key(key);
+    return Iterator(ref_, found ? found : this->fake_);
+  }
+
+  // Writes find(key) for every key of [first, last) to out; the lookups are
+  // interleaved, which pays off for batches of dozens of keys
+  template <typename KeyIt, typename OutputIt>
+  OutputIt find_many(KeyIt first, KeyIt last, OutputIt out) const {
+    this->find_nodes(first, last, [this, &out](Node* found) {
+      *out++ = Iterator(ref_, found ? found : this->fake_);
+    });
+    return out;
+  }
+
+  // Element with k smaller ones, end() if k >= size(); needs weight_balance
+  Iterator nth(size_type k) const {
+    Node* found = tree_type::find_by_rank(k);
+    return Iterator(ref_, found ? found : this->fake_);
+  }
+
+  // Number of elements with keys less than key; needs weight_balance
+  size_type rank(const key_type& key) const {
+    return tree_type::count_less(key);
+  }
+
   T& operator[](const Key& key) {
-    Node* found = BinaryTree<Key, T, Compare, Allocator>::find_by_key(key);
+    Node* found = tree_type::find_near(key);
     if (!found) {
-      found = BinaryTree<Key, T, Compare, Allocator>::insert_by_key(key, T());
+      found = tree_type::insert_by_key(key, T());
     }
     return found->value;
   }
@@ -125,24 +166,54 @@ class map : public BinaryTree<Key, T, Compare, Allocator> {
   void merge(map& other) { merge_node(other.root_, other); }
 
   Iterator begin() const {
-    return Iterator(ref_, BinaryTree<Key, T, Compare, Allocator>::get_begin());
+    return Iterator(ref_, tree_type::get_begin());
   }
 
   Iterator end() const { return Iterator(ref_, this->fake_); }
 
   ConstIterator cbegin() const {
-    return ConstIterator(ref_,
-                         BinaryTree<Key, T, Compare, Allocator>::get_begin());
+    return ConstIterator(ref_, tree_type::get_begin());
   }
 
   ConstIterator cend() const { return ConstIterator(ref_, this->fake_); }
 
+  // Builds an immutable copy laid out in one array for cache-friendly lookups
+  eytzinger_map<Key, T, Compare> freeze() const {
+    s21::vector<std::pair<Key, T>> sorted;
+    sorted.reserve(this->size_);
+    for (Node* node = this->get_begin(); node != this->fake_;
+         node = this->increment_node(node)) {
+      sorted.emplace_back(node->key, node->value);
+    }
+    return eytzinger_map<Key, T, Compare>(sorted.begin(), sorted.end());
+  }
+
+  memory_report memory_usage() const {
+    return tree_type::memory_usage(sizeof(Key) + sizeof(T));
+  }
+
+  // Writes the map to a versioned, checksummed binary file; see
+  // eytzinger_map::open() for querying it without loading
+  void save(const std::string& path) const {
+    this->save_snapshot(path, snapshot_kind::map);
+  }
+
+  // Reads a file written by save() in O(n)
+  static map load(const std::string& path) {
+    map result;
+    result.load_snapshot(path, snapshot_kind::map);
+    return result;
+  }
+
   class Iterator {
+    friend class map;
+
     map& map_;
     Node* elem_;
 
    public:
     using difference_type = std::ptrdiff_t;
+    using value_type = mapped_type;
     using pointer = value_type*;
     using reference = value_type&;
     using iterator_category = std::bidirectional_iterator_tag;
@@ -0,0 +1,30 @@
+#ifndef S21_MEMORY_H_
+#define S21_MEMORY_H_
+
+#include <cstddef>
+
+namespace s21 {
+// Heap memory a container holds on behalf of its elements. payload_bytes is
+// the elements themselves; overhead_bytes is everything else the container
+// allocated (node links, balance data, sentinels, unused capacity);
+// allocations is the number of live blocks. The container object itself is
+// not counted, except for array, whose elements live inside it.
+struct memory_report {
+  std::size_t payload_bytes = 0;
+  std::size_t overhead_bytes = 0;
+  std::size_t allocations = 0;
+
+  std::size_t total_bytes() const noexcept {
+    return payload_bytes + overhead_bytes;
+  }
+
+  memory_report &operator+=(const memory_report &other) noexcept {
+    payload_bytes += other.payload_bytes;
+    overhead_bytes += other.overhead_bytes;
+    allocations += other.allocations;
+    return *this;
+  }
+};
+}  // namespace s21
+
+#endif
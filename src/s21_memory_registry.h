@@ -0,0 +1,121 @@
+#ifndef S21_MEMORY_REGISTRY_H_
+#define S21_MEMORY_REGISTRY_H_
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#include "s21_map.h"
+#include "s21_memory.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Process-wide, opt-in list of containers whose memory_usage() should show
+// up in dumps. Nothing is tracked unless a container is registered with
+// track(); the returned registration removes it again when destroyed, so it
+// must not outlive the container.
+class memory_registry {
+ public:
+  struct entry {
+    std::string label;
+    memory_report report;
+  };
+
+  class registration {
+    std::uint64_t id_ = 0;
+
+   public:
+    registration() = default;
+    explicit registration(std::uint64_t id) : id_{id} {}
+    registration(const registration &) = delete;
+    registration(registration &&other) noexcept : id_{other.id_} {
+      other.id_ = 0;
+    }
+    registration &operator=(const registration &) = delete;
+    registration &operator=(registration &&other) noexcept {
+      if (this != &other) {
+        reset();
+        std::swap(id_, other.id_);
+      }
+      return *this;
+    }
+    ~registration() { reset(); }
+
+    void reset() {
+      if (id_) memory_registry::instance().untrack(id_);
+      id_ = 0;
+    }
+  };
+
+  static memory_registry &instance() {
+    static memory_registry registry;
+    return registry;
+  }
+
+  template <typename Container>
+  [[nodiscard]] registration track(const Container &container,
+                                   std::string label) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    probes_.insert(++last_id_,
+                   probe{std::move(label), [&container]() {
+                           return container.memory_usage();
+                         }});
+    return registration(last_id_);
+  }
+
+  // Current report of every tracked container, in registration order
+  s21::vector<entry> entries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    s21::vector<entry> result;
+    result.reserve(probes_.size());
+    for (const auto &item : probes_) {
+      result.push_back(entry{item.label, item.report()});
+    }
+    return result;
+  }
+
+  memory_report total() const {
+    memory_report sum;
+    for (const auto &item : entries()) sum += item.report;
+    return sum;
+  }
+
+  void dump(std::ostream &out) const {
+    memory_report sum;
+    for (const auto &item : entries()) {
+      print(out, item.label, item.report);
+      sum += item.report;
+    }
+    print(out, "total", sum);
+  }
+
+ private:
+  struct probe {
+    std::string label;
+    std::function<memory_report()> report;
+  };
+
+  mutable std::mutex mutex_;
+  std::uint64_t last_id_ = 0;
+  s21::map<std::uint64_t, probe> probes_;
+
+  memory_registry() = default;
+
+  void untrack(std::uint64_t id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    probes_.erase(id);
+  }
+
+  static void print(std::ostream &out, const std::string &label,
+                    const memory_report &report) {
+    out << label << ": payload " << report.payload_bytes << " B, overhead "
+        << report.overhead_bytes << " B, allocations " << report.allocations
+        << '\n';
+  }
+};
+}  // namespace s21
+
+#endif
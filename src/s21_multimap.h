@@ -0,0 +1,368 @@
+#ifndef S21_MULTIMAP_H_
+#define S21_MULTIMAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_binary_tree.h"
+#include "s21_memory.h"
+
+namespace s21 {
+// Values of one multimap key, in insertion order and contiguous: as many as
+// fit in the space of a pointer live inside the tree node, more move to one
+// heap array that grows by doubling.
+template <class T>
+class multimap_bucket {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type kInline =
+      sizeof(T) < sizeof(T *) ? sizeof(T *) / sizeof(T) : 1;
+
+  multimap_bucket() noexcept {}
+
+  multimap_bucket(const multimap_bucket &other) {
+    if (other.capacity_ > kInline) {
+      storage_.heap = std::allocator<T>().allocate(other.capacity_);
+      capacity_ = other.capacity_;
+    }
+    try {
+      for (; size_ < other.size_; ++size_) {
+        ::new (static_cast<void *>(data() + size_)) T(other.data()[size_]);
+      }
+    } catch (...) {
+      release();
+      throw;
+    }
+  }
+
+  multimap_bucket &operator=(const multimap_bucket &) = delete;
+
+  ~multimap_bucket() { release(); }
+
+  size_type size() const noexcept { return size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  // Bytes of the heap array, 0 while the values are inline
+  size_type heap_bytes() const noexcept {
+    return capacity_ > kInline ? capacity_ * sizeof(T) : 0;
+  }
+
+  T *data() noexcept {
+    return capacity_ > kInline
+               ? storage_.heap
+               : std::launder(reinterpret_cast<T *>(storage_.local));
+  }
+
+  const T *data() const noexcept {
+    return const_cast<multimap_bucket *>(this)->data();
+  }
+
+  T &operator[](size_type i) noexcept { return data()[i]; }
+
+  const T &operator[](size_type i) const noexcept { return data()[i]; }
+
+  void push_back(const T &value) {
+    if (size_ == capacity_) grow();
+    ::new (static_cast<void *>(data() + size_)) T(value);
+    ++size_;
+  }
+
+  // Removes the value at i, keeping the order of the others
+  void erase_at(size_type i) {
+    T *values = data();
+    for (; i + 1 < size_; ++i) values[i] = std::move(values[i + 1]);
+    values[--size_].~T();
+  }
+
+  // Removes every value equal to value, keeping the order of the others;
+  // returns how many were removed
+  size_type erase_value(const T &value) {
+    T *values = data();
+    size_type kept = 0;
+    for (size_type i = 0; i < size_; ++i) {
+      if (!(values[i] == value)) {
+        if (kept != i) values[kept] = std::move(values[i]);
+        ++kept;
+      }
+    }
+    size_type removed = size_ - kept;
+    while (size_ > kept) values[--size_].~T();
+    return removed;
+  }
+
+ private:
+  union storage {
+    T *heap;
+    alignas(T) unsigned char local[kInline * sizeof(T)];
+  };
+
+  storage storage_;
+  std::uint32_t size_ = 0;
+  std::uint32_t capacity_ = kInline;
+
+  void grow() {
+    if (capacity_ > std::numeric_limits<std::uint32_t>::max() / 2) {
+      throw std::length_error("multimap: too many values for one key");
+    }
+    std::uint32_t capacity = capacity_ * 2;
+    T *values = std::allocator<T>().allocate(capacity);
+    T *old = data();
+    std::uint32_t moved = 0;
+    try {
+      for (; moved < size_; ++moved) {
+        ::new (static_cast<void *>(values + moved))
+            T(std::move_if_noexcept(old[moved]));
+      }
+    } catch (...) {
+      while (moved) values[--moved].~T();
+      std::allocator<T>().deallocate(values, capacity);
+      throw;
+    }
+    for (std::uint32_t i = 0; i < size_; ++i) old[i].~T();
+    if (capacity_ > kInline) {
+      std::allocator<T>().deallocate(storage_.heap, capacity_);
+    }
+    storage_.heap = values;
+    capacity_ = capacity;
+  }
+
+  void release() noexcept {
+    T *values = data();
+    while (size_) values[--size_].~T();
+    if (capacity_ > kInline) {
+      std::allocator<T>().deallocate(storage_.heap, capacity_);
+    }
+    capacity_ = kInline;
+  }
+};
+
+// Ordered map from a key to any number of values. Every distinct key is one
+// tree node carrying its values in a multimap_bucket, so a key with a single
+// value costs a single allocation and the values of a key are read from one
+// contiguous array. Iteration goes through the keys in order and through the
+// values of each key in insertion order. Buckets are allocated with
+// std::allocator; Allocator is used for the nodes.
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>,
+          class Stats = tree_stats_disabled, class Balance = avl_balance>
+class multimap : public BinaryTree<Key, multimap_bucket<T>, Compare,
+                                   Allocator, Stats, tree_update_none, Balance> {
+  using tree_type = BinaryTree<Key, multimap_bucket<T>, Compare, Allocator,
+                               Stats, tree_update_none, Balance>;
+  using bucket_type = multimap_bucket<T>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+  using Node = typename tree_type::Node;
+
+  class Iterator;
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  multimap() = default;
+
+  multimap(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item.first, item.second);
+  }
+
+  // The tree copy counts nodes; a multimap counts values
+  multimap(const multimap &other) : tree_type(other) {
+    this->size_ = other.size_;
+  }
+
+  multimap(multimap &&other) noexcept : tree_type(std::move(other)) {}
+
+  multimap &operator=(const multimap &other) {
+    tree_type::operator=(other);
+    this->size_ = other.size_;
+    return *this;
+  }
+
+  multimap &operator=(multimap &&other) noexcept {
+    tree_type::operator=(std::move(other));
+    return *this;
+  }
+
+  // Appends value to the values of key
+  iterator insert(const Key &key, const T &value) {
+    Node *found = this->find_near(key);
+    if (found) {
+      found->value.push_back(value);
+      ++this->size_;
+    } else {
+      found = this->insert_by_key(key, bucket_type());
+      if (!found) throw std::bad_alloc();
+      try {
+        found->value.push_back(value);
+      } catch (...) {
+        this->remove_node(found);
+        throw;
+      }
+    }
+    return Iterator(this, found, found->value.size() - 1);
+  }
+
+  iterator insert(const value_type &item) {
+    return insert(item.first, item.second);
+  }
+
+  size_type count(const key_type &key) const override {
+    Node *found = this->find_by_key(key);
+    return found ? found->value.size() : 0;
+  }
+
+  // First value of key, end() if there is none
+  iterator find(const key_type &key) const {
+    Node *found = this->find_by_key(key);
+    return Iterator(this, found ? found : this->fake_, 0);
+  }
+
+  // The values of key, in insertion order
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    Node *found = this->find_by_key(key);
+    if (!found) return std::make_pair(end(), end());
+    return std::make_pair(Iterator(this, found, 0),
+                          Iterator(this, this->increment_node(found), 0));
+  }
+
+  // Removes the value at pos; returns the iterator following it
+  iterator erase(iterator pos) {
+    Node *node = pos.elem_;
+    if (node->value.size() == 1) {
+      Node *next = this->increment_node(node);
+      this->remove_node(node);
+      return Iterator(this, next, 0);
+    }
+    node->value.erase_at(pos.index_);
+    --this->size_;
+    if (pos.index_ < node->value.size()) return pos;
+    return Iterator(this, this->increment_node(node), 0);
+  }
+
+  // Removes every value of key; returns how many there were
+  size_type erase(const key_type &key) override {
+    Node *found = this->find_by_key(key);
+    if (!found) return 0;
+    size_type removed = found->value.size();
+    this->size_ -= removed - 1;
+    this->remove_node(found);
+    return removed;
+  }
+
+  // Removes the pairs (key, v) with v == value; returns how many there were
+  size_type erase(const key_type &key, const T &value) {
+    Node *found = this->find_by_key(key);
+    if (!found) return 0;
+    size_type removed = found->value.erase_value(value);
+    if (found->value.empty()) {
+      this->size_ -= removed - 1;
+      this->remove_node(found);
+    } else {
+      this->size_ -= removed;
+    }
+    return removed;
+  }
+
+  iterator begin() const { return Iterator(this, this->get_begin(), 0); }
+
+  iterator end() const { return Iterator(this, this->fake_, 0); }
+
+  // Walks the nodes to add up their spilled buckets
+  memory_report memory_usage() const {
+    memory_report report =
+        tree_type::memory_usage(sizeof(Key) + sizeof(bucket_type));
+    for (Node *node = this->get_begin(); node != this->fake_;
+         node = this->increment_node(node)) {
+      if (size_type bytes = node->value.heap_bytes()) {
+        report.overhead_bytes += bytes;
+        ++report.allocations;
+      }
+    }
+    size_type values = this->size_ * sizeof(T);
+    size_type buckets = this->node_count_ * sizeof(bucket_type);
+    report.payload_bytes = report.payload_bytes - buckets + values;
+    report.overhead_bytes = report.overhead_bytes + buckets - values;
+    return report;
+  }
+
+  class Iterator {
+    friend class multimap;
+
+    const multimap *map_ = nullptr;
+    Node *elem_ = nullptr;
+    size_type index_ = 0;
+
+    Iterator(const multimap *map, Node *elem, size_type index)
+        : map_{map}, elem_{elem}, index_{index} {}
+
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = mapped_type;
+    using pointer = value_type *;
+    using reference = value_type &;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    Iterator() = default;
+
+    const Key &key() const { return elem_->key; }
+
+    reference operator*() const { return elem_->value[index_]; }
+
+    pointer operator->() const { return &elem_->value[index_]; }
+
+    bool operator==(const Iterator &it) const {
+      return elem_ == it.elem_ && index_ == it.index_;
+    }
+
+    bool operator!=(const Iterator &it) const { return !(*this == it); }
+
+    Iterator &operator++() {
+      if (++index_ == elem_->value.size()) {
+        elem_ = map_->increment_node(elem_);
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    Iterator &operator--() {
+      if (index_) {
+        --index_;
+      } else {
+        elem_ = map_->decrement_node(elem_);
+        index_ = elem_->value.size() - 1;
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    Iterator operator--(int) {
+      Iterator tmp = *this;
+      operator--();
+      return tmp;
+    }
+  };
+};
+}  // namespace s21
+
+#endif
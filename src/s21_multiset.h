@@ -6,8 +6,13 @@
 
 namespace s21 {
 template <typename Key, class Compare = std::less<Key>,
-          class Allocator = std::allocator<Key>>
-class multiset : public BinaryTree<Key, char, Compare, Allocator> {
+          class Allocator = std::allocator<Key>,
+          class Stats = tree_stats_disabled, class Balance = avl_balance>
+class multiset : public BinaryTree<Key, char, Compare, Allocator, Stats,
+                                   tree_update_none, Balance> {
+  using tree_type = BinaryTree<Key, char, Compare, Allocator, Stats,
+                               tree_update_none, Balance>;
+
   multiset &ref_ = *this;
 
  public:
@@ -16,34 +21,35 @@ class multiset : public BinaryTree<Key, char, Compare, Allocator> {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
-  using Node = typename BinaryTree<Key, char, Compare, Allocator>::Node;
+  using Node = typename tree_type::Node;
+
+  multiset() : tree_type(){};
 
-  multiset() : BinaryTree<Key, char, Compare, Allocator>(){};
+  explicit multiset(const Allocator &alloc) : tree_type(alloc) {}
 
   explicit multiset(std::initializer_list<key_type> const &items)
-      : BinaryTree<Key, char, Compare, Allocator>() {
+      : tree_type() {
     for (auto item : items) {
       insert(item);
     }
   };
 
-  multiset(const multiset &s) : BinaryTree<Key, char, Compare, Allocator>(s){};
+  multiset(const multiset &s) : tree_type(s){};
 
-  multiset(multiset &&s)
-      : BinaryTree<Key, char, Compare, Allocator>(std::move(s)){};
+  multiset(multiset &&s) : tree_type(std::move(s)){};
 
   ~multiset(){};
 
   multiset &operator=(multiset &&s) noexcept {
     if (this != &s) {
-      BinaryTree<Key, char, Compare, Allocator>::operator=(std::move(s));
+      tree_type::operator=(std::move(s));
     }
     return *this;
   }
 
   multiset &operator=(const multiset &s) noexcept {
     if (this != &s) {
-      BinaryTree<Key, char, Compare, Allocator>::operator=(s);
+      tree_type::operator=(s);
     }
     return *this;
   }
@@ -60,15 +66,14 @@ class multiset : public BinaryTree<Key, char, Compare, Allocator> {
   using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   size_type count(const key_type &key) const override {
-    Node *found = BinaryTree<Key, char, Compare, Allocator>::find_by_key(key);
+    Node *found = tree_type::find_by_key(key);
     return found ? found->value : 0;
   }
 
   iterator insert(const key_type &value) {
-    Node *found = BinaryTree<Key, char, Compare, Allocator>::find_by_key(value);
+    Node *found = tree_type::find_near(value);
     if (!found) {
-      found =
-          BinaryTree<Key, char, Compare, Allocator>::insert_by_key(value, 1);
+      found = tree_type::insert_by_key(value, 1);
       if (!found) found = this->fake_;
     } else {
       ++this->size_;
@@ -90,42 +95,48 @@ class multiset : public BinaryTree<Key, char, Compare, Allocator> {
   }
 
   iterator find(const key_type &key) const {
-    Node *found = BinaryTree<Key, char, Compare, Allocator>::find_by_key(key);
+    Node *found = tree_type::find_by_key(key);
     return Iterator(ref_, ((found == nullptr) ? this->fake_ : found));
   }
 
+  // Writes find(key) for every key of [first, last) to out; the lookups are
+  // interleaved, which pays off for batches of dozens of keys
+  template <typename KeyIt, typename OutputIt>
+  OutputIt find_many(KeyIt first, KeyIt last, OutputIt out) const {
+    this->find_nodes(first, last, [this, &out](Node *found) {
+      *out++ = Iterator(ref_, found ? found : this->fake_);
+    });
+    return out;
+  }
+
   void erase(const Iterator &pos) {
-    if (Node *found =
-            BinaryTree<Key, char, Compare, Allocator>::find_by_key(*pos)) {
+    if (Node *found = tree_type::find_by_key(*pos)) {
       if (found->value > 1) {
         --found->value;
         --this->size_;
       } else {
-        BinaryTree<Key, char, Compare, Allocator>::remove_node(found);
+        tree_type::remove_node(found);
       }
     }
   }
 
   size_type erase(const key_type &key) override {
-    if (Node *found =
-            BinaryTree<Key, char, Compare, Allocator>::find_by_key(key)) {
+    if (Node *found = tree_type::find_by_key(key)) {
       size_type res = found->value;
       this->size_ -= (res - 1);
-      BinaryTree<Key, char, Compare, Allocator>::remove_node(found);
+      tree_type::remove_node(found);
       return res;
     }
     return 0;
   }
 
   iterator lower_bound(const key_type &key) {
-    Node *found =
-        BinaryTree<Key, char, Compare, Allocator>::find_lower_bound(key);
+    Node *found = tree_type::find_lower_bound(key);
     return found ? Iterator(ref_, found) : end();
   }
 
   iterator upper_bound(const key_type &key) {
-    Node *found =
-        BinaryTree<Key, char, Compare, Allocator>::find_upper_bound(key);
+    Node *found = tree_type::find_upper_bound(key);
     return found ? Iterator(ref_, found) : end();
   }
 
@@ -134,18 +145,38 @@ class multiset : public BinaryTree<Key, char, Compare, Allocator> {
   }
 
   iterator begin() const {
-    return Iterator(ref_,
-                    BinaryTree<Key, char, Compare, Allocator>::get_begin());
+    return Iterator(ref_, tree_type::get_begin());
   }
   iterator end() const { return Iterator(ref_, this->fake_); }
 
   const_iterator cbegin() const {
-    return const_iterator(
-        ref_, BinaryTree<Key, char, Compare, Allocator>::get_begin());
+    return const_iterator(ref_, tree_type::get_begin());
   }
 
   const_iterator cend() const { return const_iterator(ref_, this->fake_); }
 
+  // equal keys share one node, so the payload is one key per distinct value
+  memory_report memory_usage() const {
+    return tree_type::memory_usage(sizeof(Key));
+  }
+
+  // Writes the multiset to a versioned, checksummed binary file
+  void save(const std::string &path) const {
+    this->save_snapshot(path, snapshot_kind::multiset);
+  }
+
+  // Reads a file written by save() in O(n)
+  static multiset load(const std::string &path) {
+    multiset result;
+    result.load_snapshot(path, snapshot_kind::multiset);
+    result.size_ = 0;
+    for (Node *node = result.get_begin(); node != result.fake_;
+         node = result.increment_node(node)) {
+      result.size_ += node->value;
+    }
+    return result;
+  }
+
   template <typename... Args>
   s21::vector<std::pair<Iterator, bool>> insert_many(Args &&...args) {
     s21::vector<std::pair<iterator, bool>> result;
@@ -0,0 +1,166 @@
+#ifndef S21_PRIORITY_QUEUE_H_
+#define S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_memory.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Max-heap adaptor: top() is the greatest element under Compare. The heap is
+// Arity-ary; with the default 4 children per node the tree is half as deep
+// as a binary heap, and sift_down compares children that sit next to each
+// other in the container, so each level reads one contiguous run.
+template <typename T, class Container = s21::vector<T>,
+          class Compare = std::less<T>, std::size_t Arity = 4>
+class priority_queue {
+  static_assert(Arity >= 2, "a heap needs at least two children per node");
+
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+ private:
+  container_type container_;
+  Compare comp_;
+
+ public:
+  priority_queue() {}
+
+  explicit priority_queue(const Compare &comp) : comp_(comp) {}
+
+  priority_queue(std::initializer_list<value_type> const &items,
+                 const Compare &comp = Compare())
+      : priority_queue(items.begin(), items.end(), comp) {}
+
+  // Builds the heap from a range in O(n)
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare &comp = Compare())
+      : comp_(comp) {
+    for (; first != last; ++first) container_.push_back(*first);
+    heapify();
+  }
+
+  // Takes over an unordered container and builds the heap in O(n)
+  explicit priority_queue(container_type &&container,
+                          const Compare &comp = Compare())
+      : container_(std::move(container)), comp_(comp) {
+    heapify();
+  }
+
+  priority_queue(const priority_queue &other) = default;
+
+  priority_queue(priority_queue &&other) noexcept { swap(other); }
+
+  ~priority_queue() {}
+
+  priority_queue &operator=(const priority_queue &other) = default;
+
+  priority_queue &operator=(priority_queue &&other) noexcept {
+    if (this != &other) swap(other);
+    return *this;
+  }
+
+  // accesses the greatest element
+  const_reference top() const { return container_[0]; }
+
+  bool empty() const { return container_.empty(); }
+
+  size_type size() const { return container_.size(); }
+
+  memory_report memory_usage() const { return container_.memory_usage(); }
+
+  void push(const_reference value) {
+    container_.push_back(value);
+    sift_up(container_.size() - 1);
+  }
+
+  void push(value_type &&value) {
+    container_.push_back(std::move(value));
+    sift_up(container_.size() - 1);
+  }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    container_.emplace_back(std::forward<Args>(args)...);
+    sift_up(container_.size() - 1);
+  }
+
+  // removes the greatest element
+  void pop() {
+    size_type last = container_.size() - 1;
+    if (last) {
+      value_type moved = std::move(container_[last]);
+      container_.pop_back();
+      sift_down(0, std::move(moved));
+    } else {
+      container_.pop_back();
+    }
+  }
+
+  void swap(priority_queue &other) noexcept {
+    using std::swap;
+    swap(container_, other.container_);
+    swap(comp_, other.comp_);
+  }
+
+  template <typename... Args>
+  void insert_many(Args &&...args) {
+    (push(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  static size_type parent(size_type i) noexcept { return (i - 1) / Arity; }
+
+  static size_type first_child(size_type i) noexcept { return i * Arity + 1; }
+
+  // Moves the hole at i up to where container_[i] belongs, shifting each
+  // smaller parent down instead of swapping
+  void sift_up(size_type i) {
+    if (!i || !comp_(container_[parent(i)], container_[i])) return;
+    value_type value = std::move(container_[i]);
+    do {
+      container_[i] = std::move(container_[parent(i)]);
+      i = parent(i);
+    } while (i && comp_(container_[parent(i)], value));
+    container_[i] = std::move(value);
+  }
+
+  // Places value in the hole at i, lifting the greatest child until value
+  // is not less than any child
+  void sift_down(size_type i, value_type value) {
+    const size_type n = container_.size();
+    for (size_type child = first_child(i); child < n;
+         child = first_child(i)) {
+      size_type end = child + Arity < n ? child + Arity : n;
+      size_type best = child;
+      for (++child; child < end; ++child) {
+        if (comp_(container_[best], container_[child])) best = child;
+      }
+      if (!comp_(value, container_[best])) break;
+      container_[i] = std::move(container_[best]);
+      i = best;
+    }
+    container_[i] = std::move(value);
+  }
+
+  void heapify() {
+    size_type n = container_.size();
+    if (n < 2) return;
+    for (size_type i = parent(n - 1) + 1; i-- > 0;) {
+      sift_down(i, std::move(container_[i]));
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif
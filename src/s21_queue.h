@@ -43,6 +43,8 @@ class queue {
 
   size_t size() const { return container_.size(); }
 
+  memory_report memory_usage() const { return container_.memory_usage(); }
+
   T &front() { return container_.front(); }
 
   T &back() { return container_.back(); }
@@ -0,0 +1,517 @@
+#ifndef S21_RADIX_MAP_H_
+#define S21_RADIX_MAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "s21_memory.h"
+
+namespace s21 {
+
+// Map from strings to V stored as a compressed trie: every edge carries the
+// longest run of bytes its keys share, so a common prefix is stored once and
+// compared once per lookup. A node is a single allocation with its edge label
+// inline, and keys are never stored whole. Iteration is in byte-wise
+// lexicographic order.
+template <typename V, class Allocator = std::allocator<V>>
+class radix_map {
+  struct Node;
+  struct block;
+
+  using allocator_traits = std::allocator_traits<Allocator>;
+  using block_allocator_type =
+      typename allocator_traits::template rebind_alloc<block>;
+  using block_allocator_traits = std::allocator_traits<block_allocator_type>;
+
+ public:
+  using key_type = std::string;
+  using mapped_type = V;
+  using size_type = std::size_t;
+
+  class Iterator;
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  radix_map() : root_{create_node(std::string_view())} {}
+
+  radix_map(std::initializer_list<std::pair<std::string, V>> const &items)
+      : radix_map() {
+    for (const auto &item : items) insert(item.first, item.second);
+  }
+
+  radix_map(const radix_map &other) : radix_map() {
+    for (auto it = other.begin(); it != other.end(); ++it) {
+      insert(it.key(), *it);
+    }
+  }
+
+  radix_map(radix_map &&other) : radix_map() { swap(other); }
+
+  ~radix_map() { destroy(root_); }
+
+  radix_map &operator=(const radix_map &other) {
+    if (this != &other) {
+      radix_map copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  radix_map &operator=(radix_map &&other) noexcept {
+    if (this != &other) {
+      swap(other);
+      other.clear();
+    }
+    return *this;
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  std::pair<iterator, bool> insert(std::string_view key, const V &value) {
+    return add(key, value, false);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(std::string_view key,
+                                             const V &value) {
+    return add(key, value, true);
+  }
+
+  V &operator[](std::string_view key) {
+    Node *node = find_node(key);
+    if (!node) node = add(key, V(), false).first.node_;
+    return node->value();
+  }
+
+  V &at(std::string_view key) {
+    Node *node = find_node(key);
+    if (!node) throw std::out_of_range("key not found");
+    return node->value();
+  }
+
+  const V &at(std::string_view key) const {
+    Node *node = find_node(key);
+    if (!node) throw std::out_of_range("key not found");
+    return node->value();
+  }
+
+  iterator find(std::string_view key) const {
+    Node *node = find_node(key);
+    return node ? Iterator(node, std::string(key)) : end();
+  }
+
+  bool contains(std::string_view key) const {
+    return find_node(key) != nullptr;
+  }
+
+  // Entry whose key is the longest prefix of text, end() if none is
+  iterator longest_prefix_match(std::string_view text) const {
+    Node *node = root_;
+    Node *best = node->has_value ? node : nullptr;
+    size_type best_length = 0, matched = 0;
+    while (matched < text.size()) {
+      node = child_of(node, text[matched]);
+      if (!node || !label_matches(node, text, matched)) break;
+      matched += node->length;
+      if (node->has_value) {
+        best = node;
+        best_length = matched;
+      }
+    }
+    return best ? Iterator(best, std::string(text.substr(0, best_length)))
+                : end();
+  }
+
+  // Entries whose keys start with prefix, in order
+  std::pair<iterator, iterator> prefix_range(std::string_view prefix) const {
+    Node *node = root_;
+    size_type matched = 0;
+    while (matched < prefix.size()) {
+      node = child_of(node, prefix[matched]);
+      if (!node) return std::make_pair(end(), end());
+      size_type length = node->length;
+      if (prefix.size() - matched < length) length = prefix.size() - matched;
+      if (prefix.compare(matched, length, node->label().substr(0, length))) {
+        return std::make_pair(end(), end());
+      }
+      matched += node->length;
+    }
+    Iterator first(node, path_of(node));
+    if (!node->has_value) ++first;
+    Iterator last = end();
+    if (node != root_) {
+      last = Iterator(node, path_of(node));
+      last.skip_subtree();
+    }
+    return std::make_pair(first, last);
+  }
+
+  // Removes the key and prunes or merges the nodes it leaves redundant
+  size_type erase(std::string_view key) {
+    Node *node = find_node(key);
+    if (!node) return 0;
+    reset_value(node);
+    --size_;
+    while (node != root_ && !node->has_value && !node->child) {
+      Node *parent = node->parent;
+      *slot_of(node) = node->sibling;
+      destroy_node(node);
+      node = parent;
+    }
+    if (node != root_ && !node->has_value && !node->child->sibling) {
+      try {
+        merge_with_child(node);
+      } catch (const std::bad_alloc &) {
+        // an unmerged node only costs memory
+      }
+    }
+    return 1;
+  }
+
+  void clear() noexcept {
+    destroy(root_->child);
+    root_->child = nullptr;
+    reset_value(root_);
+    size_ = 0;
+  }
+
+  void swap(radix_map &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(nodes_, other.nodes_);
+    std::swap(bytes_, other.bytes_);
+    std::swap(alloc_, other.alloc_);
+  }
+
+  iterator begin() const {
+    Iterator it(root_, std::string());
+    if (!root_->has_value) ++it;
+    return it;
+  }
+
+  iterator end() const { return Iterator(); }
+
+  memory_report memory_usage() const {
+    memory_report report;
+    report.payload_bytes = size_ * sizeof(V);
+    report.overhead_bytes = bytes_ - report.payload_bytes;
+    report.allocations = nodes_;
+    return report;
+  }
+
+  class Iterator {
+    friend class radix_map;
+
+    Node *node_ = nullptr;
+    std::string key_;
+
+    Iterator(Node *node, std::string key)
+        : node_{node}, key_{std::move(key)} {}
+
+    // Moves to the first entry after the current subtree in key order
+    void skip_subtree() {
+      while (node_ && !node_->sibling) {
+        key_.resize(key_.size() - node_->length);
+        node_ = node_->parent;
+      }
+      if (node_) {
+        key_.resize(key_.size() - node_->length);
+        node_ = node_->sibling;
+        key_ += node_->label();
+        if (!node_->has_value) ++*this;
+      }
+    }
+
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = mapped_type;
+    using pointer = value_type *;
+    using reference = value_type &;
+    using iterator_category = std::forward_iterator_tag;
+
+    Iterator() = default;
+
+    const std::string &key() const { return key_; }
+
+    reference operator*() const { return node_->value(); }
+
+    pointer operator->() const { return &node_->value(); }
+
+    bool operator==(const Iterator &it) const { return node_ == it.node_; }
+
+    bool operator!=(const Iterator &it) const { return node_ != it.node_; }
+
+    // Pre-order walk over the trie until the next node holding a value
+    Iterator &operator++() {
+      do {
+        if (!node_->child) {
+          skip_subtree();
+          return *this;
+        }
+        node_ = node_->child;
+        key_ += node_->label();
+      } while (!node_->has_value);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+  };
+
+ private:
+  // Header of a node allocation; the label bytes follow it. Children form a
+  // singly linked list ordered by the first byte of their labels, which is
+  // unique among siblings. Only the root has an empty label.
+  struct Node {
+    Node *parent = nullptr;
+    Node *child = nullptr;
+    Node *sibling = nullptr;
+    std::uint32_t length;
+    bool has_value = false;
+    alignas(V) unsigned char storage[sizeof(V)];
+
+    explicit Node(std::uint32_t n) noexcept : length{n} {}
+
+    char *data() noexcept { return reinterpret_cast<char *>(this + 1); }
+
+    std::string_view label() const noexcept {
+      return std::string_view(reinterpret_cast<const char *>(this + 1),
+                              length);
+    }
+
+    V &value() noexcept {
+      return *std::launder(reinterpret_cast<V *>(storage));
+    }
+  };
+
+  // Allocation unit of nodes
+  struct alignas(Node) block {
+    unsigned char bytes[alignof(Node)];
+  };
+
+  // declared before root_, which the constructors allocate first
+  block_allocator_type alloc_;
+  size_type size_ = 0;
+  size_type nodes_ = 0;
+  size_type bytes_ = 0;
+  Node *root_;
+
+  static size_type blocks_for(size_type length) noexcept {
+    return (sizeof(Node) + length + sizeof(block) - 1) / sizeof(block);
+  }
+
+  // Node labelled with head followed by tail, without value or links
+  Node *create_node(std::string_view head, std::string_view tail = {}) {
+    size_type length = head.size() + tail.size();
+    if (length > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::length_error("radix_map: key too long");
+    }
+    size_type blocks = blocks_for(length);
+    block *raw = block_allocator_traits::allocate(alloc_, blocks);
+    Node *node = ::new (static_cast<void *>(raw))
+        Node(static_cast<std::uint32_t>(length));
+    if (!head.empty()) std::memcpy(node->data(), head.data(), head.size());
+    if (!tail.empty()) {
+      std::memcpy(node->data() + head.size(), tail.data(), tail.size());
+    }
+    ++nodes_;
+    bytes_ += blocks * sizeof(block);
+    return node;
+  }
+
+  void destroy_node(Node *node) noexcept {
+    reset_value(node);
+    size_type blocks = blocks_for(node->length);
+    node->~Node();
+    block_allocator_traits::deallocate(alloc_, reinterpret_cast<block *>(node),
+                                       blocks);
+    --nodes_;
+    bytes_ -= blocks * sizeof(block);
+  }
+
+  static void set_value(Node *node, const V &value) {
+    ::new (static_cast<void *>(node->storage)) V(value);
+    node->has_value = true;
+  }
+
+  static void reset_value(Node *node) noexcept {
+    if (node->has_value) {
+      node->value().~V();
+      node->has_value = false;
+    }
+  }
+
+  // Frees a subtree and its following siblings without recursion, treating
+  // child and sibling as the left and right links of a binary tree
+  void destroy(Node *node) noexcept {
+    while (node) {
+      if (Node *first = node->child) {
+        node->child = first->sibling;
+        first->sibling = node;
+        node = first;
+      } else {
+        Node *next = node->sibling;
+        destroy_node(node);
+        node = next;
+      }
+    }
+  }
+
+  static bool label_matches(const Node *node, std::string_view key,
+                            size_type pos) noexcept {
+    return key.size() - pos >= node->length &&
+           !std::memcmp(key.data() + pos, node->label().data(), node->length);
+  }
+
+  static Node *child_of(const Node *node, char first) noexcept {
+    Node *child = node->child;
+    while (child && static_cast<unsigned char>(child->label()[0]) <
+                        static_cast<unsigned char>(first)) {
+      child = child->sibling;
+    }
+    return child && child->label()[0] == first ? child : nullptr;
+  }
+
+  // Links node among the children of parent, keeping them ordered
+  static void link(Node *parent, Node *node) noexcept {
+    Node **slot = &parent->child;
+    while (*slot && static_cast<unsigned char>((*slot)->label()[0]) <
+                        static_cast<unsigned char>(node->label()[0])) {
+      slot = &(*slot)->sibling;
+    }
+    node->sibling = *slot;
+    node->parent = parent;
+    *slot = node;
+  }
+
+  // The link that points at a non-root node
+  static Node **slot_of(Node *node) noexcept {
+    Node **slot = &node->parent->child;
+    while (*slot != node) slot = &(*slot)->sibling;
+    return slot;
+  }
+
+  // Moves the value and children of from to to
+  static void take_over(Node *to, Node *from) {
+    if (from->has_value) {
+      ::new (static_cast<void *>(to->storage)) V(std::move(from->value()));
+      to->has_value = true;
+      reset_value(from);
+    }
+    to->child = from->child;
+    from->child = nullptr;
+    for (Node *child = to->child; child; child = child->sibling) {
+      child->parent = to;
+    }
+  }
+
+  // Puts replacement in the place of node among its siblings
+  static void replace(Node *node, Node *replacement) noexcept {
+    replacement->parent = node->parent;
+    replacement->sibling = node->sibling;
+    *slot_of(node) = replacement;
+  }
+
+  static std::string path_of(const Node *node) {
+    std::string path;
+    for (; node; node = node->parent) path.insert(0, node->label());
+    return path;
+  }
+
+  Node *find_node(std::string_view key) const {
+    Node *node = root_;
+    size_type matched = 0;
+    while (matched < key.size()) {
+      node = child_of(node, key[matched]);
+      if (!node || !label_matches(node, key, matched)) return nullptr;
+      matched += node->length;
+    }
+    return node->has_value ? node : nullptr;
+  }
+
+  std::pair<iterator, bool> add(std::string_view key, const V &value,
+                                bool assign) {
+    Node *node = root_;
+    size_type matched = 0;
+    while (matched < key.size()) {
+      Node *child = child_of(node, key[matched]);
+      if (!child) {
+        Node *leaf = create_node(key.substr(matched));
+        try {
+          set_value(leaf, value);
+        } catch (...) {
+          destroy_node(leaf);
+          throw;
+        }
+        link(node, leaf);
+        ++size_;
+        return std::make_pair(Iterator(leaf, std::string(key)), true);
+      }
+      std::string_view label = child->label();
+      size_type common = 1;
+      while (common < label.size() && matched + common < key.size() &&
+             label[common] == key[matched + common]) {
+        ++common;
+      }
+      node = common < label.size() ? split(child, common) : child;
+      matched += common;
+    }
+    bool inserted = !node->has_value;
+    if (inserted) {
+      set_value(node, value);
+      ++size_;
+    } else if (assign) {
+      node->value() = value;
+    }
+    return std::make_pair(Iterator(node, std::string(key)), inserted);
+  }
+
+  // Cuts node's label after length bytes, returning the new upper node
+  Node *split(Node *node, size_type length) {
+    std::string_view label = node->label();
+    Node *head = create_node(label.substr(0, length));
+    Node *rest;
+    try {
+      rest = create_node(label.substr(length));
+    } catch (...) {
+      destroy_node(head);
+      throw;
+    }
+    take_over(rest, node);
+    replace(node, head);
+    head->child = rest;
+    rest->parent = head;
+    destroy_node(node);
+    return head;
+  }
+
+  // Folds the only child of a valueless node into it
+  void merge_with_child(Node *node) {
+    Node *child = node->child;
+    Node *merged = create_node(node->label(), child->label());
+    take_over(merged, child);
+    replace(node, merged);
+    node->child = nullptr;
+    destroy_node(child);
+    destroy_node(node);
+  }
+};
+
+}  // namespace s21
+
+#endif
@@ -2,12 +2,18 @@
 #define S21_SET_H_
 
 #include "s21_binary_tree.h"
+#include "s21_eytzinger.h"
 #include "s21_vector.h"
 
 namespace s21 {
 template <typename Key, class Compare = std::less<Key>,
-          class Allocator = std::allocator<Key>>
-class set : public BinaryTree<Key, char, Compare, Allocator> {
+          class Allocator = std::allocator<Key>,
+          class Stats = tree_stats_disabled, class Balance = avl_balance>
+class set : public BinaryTree<Key, char, Compare, Allocator, Stats,
+                              tree_update_none, Balance> {
+  using tree_type = BinaryTree<Key, char, Compare, Allocator, Stats,
+                               tree_update_none, Balance>;
+
   set &ref_ = *this;
 
  public:
@@ -15,31 +21,33 @@ class set : public BinaryTree<Key, char, Compare, Allocator> {
   using value_type = Key;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using Node = typename BinaryTree<Key, char, Compare, Allocator>::Node;
+  using Node = typename tree_type::Node;
   using size_type = size_t;
 
-  set() : BinaryTree<Key, char, Compare, Allocator>(){};
+  set() : tree_type(){};
+
+  explicit set(const Allocator &alloc) : tree_type(alloc) {}
 
   explicit set(std::initializer_list<key_type> const &items)
-      : BinaryTree<Key, char, Compare, Allocator>() {
+      : tree_type() {
     for (auto item : items) {
       insert(item);
     }
   };
 
-  set(const set &s) : BinaryTree<Key, char, Compare, Allocator>(s){};
+  set(const set &s) : tree_type(s){};
 
-  set(set &&s) : BinaryTree<Key, char, Compare, Allocator>(std::move(s)){};
+  set(set &&s) : tree_type(std::move(s)){};
 
   ~set(){};
 
   set &operator=(set &&s) noexcept {
-    BinaryTree<Key, char, Compare, Allocator>::operator=(std::move(s));
+    tree_type::operator=(std::move(s));
     return *this;
   }
 
   set &operator=(const set &s) noexcept {
-    BinaryTree<Key, char, Compare, Allocator>::operator=(s);
+    tree_type::operator=(s);
     return *this;
   }
 
@@ -55,11 +63,10 @@ class set : public BinaryTree<Key, char, Compare, Allocator> {
   using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   std::pair<Iterator, bool> insert(const key_type &value) {
-    Node *found = BinaryTree<Key, char, Compare, Allocator>::find_by_key(value);
+    Node *found = tree_type::find_near(value);
     bool inserted = false;
     if (!found) {
-      found =
-          BinaryTree<Key, char, Compare, Allocator>::insert_by_key(value, 1);
+      found = tree_type::insert_by_key(value, 1);
       if (!found)
         found = this->fake_;  // если не создалось
       else
@@ -68,6 +75,17 @@ class set : public BinaryTree<Key, char, Compare, Allocator> {
     return std::make_pair(Iterator(ref_, found), inserted);
   }
 
+  // Inserts value right before hint in amortized O(1) when it belongs there;
+  // a wrong hint costs a descent from the root, as insert(value) does
+  Iterator insert(Iterator hint, const key_type &value) {
+    Node *found = tree_type::find_near(value, hint.elem_);
+    if (!found) {
+      found = tree_type::insert_by_key(value, 1, hint.elem_);
+      if (!found) found = this->fake_;  // LCOV_EXCL_LINE
+    }
+    return Iterator(ref_, found);
+  }
+
   void merge(set &other) {
     s21::vector<Key> merged;
     for (auto item : other) {
@@ -81,27 +99,46 @@ class set : public BinaryTree<Key, char, Compare, Allocator> {
   }
 
   Iterator find(const key_type &key) const {
-    Node *found = BinaryTree<Key, char, Compare, Allocator>::find_by_key(key);
+    Node *found = tree_type::find_by_key(key);
     return Iterator(ref_, ((found == nullptr) ? this->fake_ : found));
   }
 
+  // Writes find(key) for every key of [first, last) to out; the lookups are
+  // interleaved, which pays off for batches of dozens of keys
+  template <typename KeyIt, typename OutputIt>
+  OutputIt find_many(KeyIt first, KeyIt last, OutputIt out) const {
+    this->find_nodes(first, last, [this, &out](Node *found) {
+      *out++ = Iterator(ref_, found ? found : this->fake_);
+    });
+    return out;
+  }
+
+  // Element with k smaller ones, end() if k >= size(); needs weight_balance
+  Iterator nth(size_type k) const {
+    Node *found = tree_type::find_by_rank(k);
+    return Iterator(ref_, found ? found : this->fake_);
+  }
+
+  // Number of elements with keys less than key; needs weight_balance
+  size_type rank(const key_type &key) const {
+    return tree_type::count_less(key);
+  }
+
   void erase(Iterator pos) {
-    BinaryTree<Key, char, Compare, Allocator>::erase(*pos);
+    tree_type::erase(*pos);
   }
 
   size_type erase(const key_type &key) override {
-    return BinaryTree<Key, char, Compare, Allocator>::erase(key);
+    return tree_type::erase(key);
   }
 
   Iterator lower_bound(const key_type &key) {
-    Node *found =
-        BinaryTree<Key, char, Compare, Allocator>::find_lower_bound(key);
+    Node *found = tree_type::find_lower_bound(key);
     return found ? Iterator(ref_, found) : end();
   }
 
   Iterator upper_bound(const key_type &key) {
-    Node *found =
-        BinaryTree<Key, char, Compare, Allocator>::find_upper_bound(key);
+    Node *found = tree_type::find_upper_bound(key);
     return found ? Iterator(ref_, found) : end();
   }
 
@@ -110,19 +147,34 @@ class set : public BinaryTree<Key, char, Compare, Allocator> {
   }
 
   Iterator begin() const {
-    return Iterator(ref_,
-                    BinaryTree<Key, char, Compare, Allocator>::get_begin());
+    return Iterator(ref_, tree_type::get_begin());
   }
 
   Iterator end() const { return Iterator(ref_, this->fake_); }
 
   ConstIterator cbegin() const {
-    return ConstIterator(
-        ref_, BinaryTree<Key, char, Compare, Allocator>::get_begin());
+    return ConstIterator(ref_, tree_type::get_begin());
   }
 
   ConstIterator cend() const { return ConstIterator(ref_, this->fake_); }
 
+  memory_report memory_usage() const {
+    return tree_type::memory_usage(sizeof(Key));
+  }
+
+  // Writes the set to a versioned, checksummed binary file; see
+  // eytzinger_set::open() for querying it without loading
+  void save(const std::string &path) const {
+    this->save_snapshot(path, snapshot_kind::set);
+  }
+
+  // Reads a file written by save() in O(n)
+  static set load(const std::string &path) {
+    set result;
+    result.load_snapshot(path, snapshot_kind::set);
+    return result;
+  }
+
   template <typename... Args>
   s21::vector<std::pair<Iterator, bool>> insert_many(Args &&...args) {
     s21::vector<std::pair<iterator, bool>> result;
@@ -130,7 +182,14 @@ class set : public BinaryTree<Key, char, Compare, Allocator> {
     return result;
   }
 
+  // Builds an immutable copy laid out in one array for cache-friendly lookups
+  eytzinger_set<Key, Compare> freeze() const {
+    return eytzinger_set<Key, Compare>(begin(), end());
+  }
+
   class Iterator {
+    friend class set;
+
     set &set_;
     Node *elem_;
 
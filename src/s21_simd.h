@@ -0,0 +1,953 @@
+#ifndef S21_SIMD_H_
+#define S21_SIMD_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86_ 1
+#include <immintrin.h>
+#define S21_SIMD_SSE2_ __attribute__((target("sse2")))
+#define S21_SIMD_AVX2_ __attribute__((target("avx2")))
+#else
+#define S21_SIMD_X86_ 0
+#endif
+
+namespace s21 {
+// Scans over contiguous s21 containers (vector, array, small_vector,
+// static_vector) or pointer ranges with SSE2 and AVX2 kernels, picked once
+// at runtime from what the CPU supports, with a scalar fallback. Kernels
+// cover 1- and 4-byte integers and float: find, count, equal and fill for
+// all of them, min_element, max_element and accumulate for std::int32_t,
+// std::uint8_t and float. Other types use the std algorithms.
+namespace simd {
+enum class isa { scalar, sse2, avx2 };
+
+// Kernels for one instruction set; indices are n when nothing matches, and
+// the min and max kernels need n > 0
+struct kernels_ {
+  std::size_t (*find_u8)(const std::uint8_t *, std::size_t, std::uint8_t);
+  std::size_t (*find_u32)(const std::uint32_t *, std::size_t, std::uint32_t);
+  std::size_t (*find_f32)(const float *, std::size_t, float);
+  std::size_t (*count_u8)(const std::uint8_t *, std::size_t, std::uint8_t);
+  std::size_t (*count_u32)(const std::uint32_t *, std::size_t, std::uint32_t);
+  std::size_t (*count_f32)(const float *, std::size_t, float);
+  std::uint8_t (*min_u8)(const std::uint8_t *, std::size_t);
+  std::uint8_t (*max_u8)(const std::uint8_t *, std::size_t);
+  std::int32_t (*min_i32)(const std::int32_t *, std::size_t);
+  std::int32_t (*max_i32)(const std::int32_t *, std::size_t);
+  // set *unordered if a NaN was seen, which makes the result meaningless
+  float (*min_f32)(const float *, std::size_t, bool *unordered);
+  float (*max_f32)(const float *, std::size_t, bool *unordered);
+  std::uint64_t (*sum_u8)(const std::uint8_t *, std::size_t);
+  std::int64_t (*sum_i32)(const std::int32_t *, std::size_t);
+  float (*sum_f32)(const float *, std::size_t);
+  bool (*equal_f32)(const float *, const float *, std::size_t);
+  void (*fill_u32)(std::uint32_t *, std::size_t, std::uint32_t);
+};
+
+// Scalar kernels, also used for the tails the vector loops leave
+template <typename T>
+std::size_t find_scalar_(const T *data, std::size_t n, T value) {
+  for (std::size_t i = 0; i < n; ++i) {
+    if (data[i] == value) return i;
+  }
+  return n;
+}
+
+template <typename T>
+std::size_t count_scalar_(const T *data, std::size_t n, T value) {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i) count += data[i] == value;
+  return count;
+}
+
+template <typename T>
+T min_scalar_(const T *data, std::size_t n) {
+  T min = data[0];
+  for (std::size_t i = 1; i < n; ++i) min = data[i] < min ? data[i] : min;
+  return min;
+}
+
+template <typename T>
+T max_scalar_(const T *data, std::size_t n) {
+  T max = data[0];
+  for (std::size_t i = 1; i < n; ++i) max = max < data[i] ? data[i] : max;
+  return max;
+}
+
+inline float min_f32_scalar_(const float *data, std::size_t n,
+                             bool *unordered) {
+  *unordered = std::any_of(data, data + n, [](float x) { return x != x; });
+  return min_scalar_(data, n);
+}
+
+inline float max_f32_scalar_(const float *data, std::size_t n,
+                             bool *unordered) {
+  *unordered = std::any_of(data, data + n, [](float x) { return x != x; });
+  return max_scalar_(data, n);
+}
+
+template <typename Sum, typename T>
+Sum sum_scalar_(const T *data, std::size_t n) {
+  Sum sum = 0;
+  for (std::size_t i = 0; i < n; ++i) sum += data[i];
+  return sum;
+}
+
+inline bool equal_f32_scalar_(const float *a, const float *b, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!(a[i] == b[i])) return false;
+  }
+  return true;
+}
+
+inline void fill_u32_scalar_(std::uint32_t *data, std::size_t n,
+                             std::uint32_t value) {
+  for (std::size_t i = 0; i < n; ++i) data[i] = value;
+}
+
+inline constexpr kernels_ kScalarKernels_ = {
+    find_scalar_<std::uint8_t>,
+    find_scalar_<std::uint32_t>,
+    find_scalar_<float>,
+    count_scalar_<std::uint8_t>,
+    count_scalar_<std::uint32_t>,
+    count_scalar_<float>,
+    min_scalar_<std::uint8_t>,
+    max_scalar_<std::uint8_t>,
+    min_scalar_<std::int32_t>,
+    max_scalar_<std::int32_t>,
+    min_f32_scalar_,
+    max_f32_scalar_,
+    sum_scalar_<std::uint64_t, std::uint8_t>,
+    sum_scalar_<std::int64_t, std::int32_t>,
+    sum_scalar_<float, float>,
+    equal_f32_scalar_,
+    fill_u32_scalar_,
+};
+
+#if S21_SIMD_X86_
+// SSE2: 16 bytes per step
+
+S21_SIMD_SSE2_ inline __m128i load_sse2_(const void *data) {
+  return _mm_loadu_si128(static_cast<const __m128i *>(data));
+}
+
+S21_SIMD_SSE2_ inline std::size_t find_u8_sse2_(const std::uint8_t *data,
+                                                std::size_t n,
+                                                std::uint8_t value) {
+  const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i block = load_sse2_(data + i);
+    int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i + find_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_SSE2_ inline std::size_t find_u32_sse2_(const std::uint32_t *data,
+                                                 std::size_t n,
+                                                 std::uint32_t value) {
+  const __m128i needle = _mm_set1_epi32(static_cast<int>(value));
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i block = load_sse2_(data + i);
+    int mask =
+        _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i + find_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_SSE2_ inline std::size_t find_f32_sse2_(const float *data,
+                                                 std::size_t n, float value) {
+  const __m128 needle = _mm_set1_ps(value);
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i + find_scalar_(data + i, n - i, value);
+}
+
+// Byte hit counters are flushed every 255 blocks, before they can wrap
+S21_SIMD_SSE2_ inline std::size_t count_u8_sse2_(const std::uint8_t *data,
+                                                 std::size_t n,
+                                                 std::uint8_t value) {
+  const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+  const __m128i zero = _mm_setzero_si128();
+  std::size_t count = 0;
+  std::size_t i = 0;
+  std::size_t vector_end = n / 16 * 16;
+  while (i < vector_end) {
+    std::size_t stop = std::min(vector_end, i + 255 * 16);
+    __m128i hits = zero;
+    for (; i < stop; i += 16) {
+      hits = _mm_sub_epi8(hits, _mm_cmpeq_epi8(load_sse2_(data + i), needle));
+    }
+    alignas(16) std::uint64_t sums[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(sums),
+                    _mm_sad_epu8(hits, zero));
+    count += sums[0] + sums[1];
+  }
+  return count + count_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_SSE2_ inline std::size_t count_u32_sse2_(const std::uint32_t *data,
+                                                  std::size_t n,
+                                                  std::uint32_t value) {
+  const __m128i needle = _mm_set1_epi32(static_cast<int>(value));
+  std::size_t count = 0;
+  std::size_t i = 0;
+  std::size_t vector_end = n / 4 * 4;
+  while (i < vector_end) {
+    std::size_t stop = std::min(vector_end, i + (std::size_t(1) << 30));
+    __m128i hits = _mm_setzero_si128();
+    for (; i < stop; i += 4) {
+      hits = _mm_sub_epi32(hits, _mm_cmpeq_epi32(load_sse2_(data + i), needle));
+    }
+    alignas(16) std::uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), hits);
+    count += std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+  }
+  return count + count_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_SSE2_ inline std::size_t count_f32_sse2_(const float *data,
+                                                  std::size_t n, float value) {
+  const __m128 needle = _mm_set1_ps(value);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  std::size_t vector_end = n / 4 * 4;
+  while (i < vector_end) {
+    std::size_t stop = std::min(vector_end, i + (std::size_t(1) << 30));
+    __m128i hits = _mm_setzero_si128();
+    for (; i < stop; i += 4) {
+      __m128 equal = _mm_cmpeq_ps(_mm_loadu_ps(data + i), needle);
+      hits = _mm_sub_epi32(hits, _mm_castps_si128(equal));
+    }
+    alignas(16) std::uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), hits);
+    count += std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+  }
+  return count + count_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_SSE2_ inline std::uint8_t min_u8_sse2_(const std::uint8_t *data,
+                                                std::size_t n) {
+  if (n < 16) return min_scalar_(data, n);
+  __m128i min = load_sse2_(data);
+  std::size_t i = 16;
+  for (; i + 16 <= n; i += 16) min = _mm_min_epu8(min, load_sse2_(data + i));
+  alignas(16) std::uint8_t lanes[16];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), min);
+  std::uint8_t result = min_scalar_(lanes, 16);
+  return i < n ? std::min(result, min_scalar_(data + i, n - i)) : result;
+}
+
+S21_SIMD_SSE2_ inline std::uint8_t max_u8_sse2_(const std::uint8_t *data,
+                                                std::size_t n) {
+  if (n < 16) return max_scalar_(data, n);
+  __m128i max = load_sse2_(data);
+  std::size_t i = 16;
+  for (; i + 16 <= n; i += 16) max = _mm_max_epu8(max, load_sse2_(data + i));
+  alignas(16) std::uint8_t lanes[16];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), max);
+  std::uint8_t result = max_scalar_(lanes, 16);
+  return i < n ? std::max(result, max_scalar_(data + i, n - i)) : result;
+}
+
+// SSE2 has no pminsd/pmaxsd; select through a compare mask
+S21_SIMD_SSE2_ inline __m128i select_sse2_(__m128i mask, __m128i if_set,
+                                           __m128i if_clear) {
+  return _mm_or_si128(_mm_and_si128(mask, if_set),
+                      _mm_andnot_si128(mask, if_clear));
+}
+
+S21_SIMD_SSE2_ inline std::int32_t min_i32_sse2_(const std::int32_t *data,
+                                                 std::size_t n) {
+  if (n < 4) return min_scalar_(data, n);
+  __m128i min = load_sse2_(data);
+  std::size_t i = 4;
+  for (; i + 4 <= n; i += 4) {
+    __m128i block = load_sse2_(data + i);
+    min = select_sse2_(_mm_cmplt_epi32(block, min), block, min);
+  }
+  alignas(16) std::int32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), min);
+  std::int32_t result = min_scalar_(lanes, 4);
+  return i < n ? std::min(result, min_scalar_(data + i, n - i)) : result;
+}
+
+S21_SIMD_SSE2_ inline std::int32_t max_i32_sse2_(const std::int32_t *data,
+                                                 std::size_t n) {
+  if (n < 4) return max_scalar_(data, n);
+  __m128i max = load_sse2_(data);
+  std::size_t i = 4;
+  for (; i + 4 <= n; i += 4) {
+    __m128i block = load_sse2_(data + i);
+    max = select_sse2_(_mm_cmpgt_epi32(block, max), block, max);
+  }
+  alignas(16) std::int32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), max);
+  std::int32_t result = max_scalar_(lanes, 4);
+  return i < n ? std::max(result, max_scalar_(data + i, n - i)) : result;
+}
+
+S21_SIMD_SSE2_ inline float min_f32_sse2_(const float *data, std::size_t n,
+                                          bool *unordered) {
+  if (n < 4) return min_f32_scalar_(data, n, unordered);
+  __m128 min = _mm_loadu_ps(data);
+  __m128 nan = _mm_cmpunord_ps(min, min);
+  std::size_t i = 4;
+  for (; i + 4 <= n; i += 4) {
+    __m128 block = _mm_loadu_ps(data + i);
+    nan = _mm_or_ps(nan, _mm_cmpunord_ps(block, block));
+    min = _mm_min_ps(min, block);
+  }
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, min);
+  float result = min_scalar_(lanes, 4);
+  bool tail_nan = false;
+  if (i < n) {
+    result = std::min(result, min_f32_scalar_(data + i, n - i, &tail_nan));
+  }
+  *unordered = _mm_movemask_ps(nan) != 0 || tail_nan;
+  return result;
+}
+
+S21_SIMD_SSE2_ inline float max_f32_sse2_(const float *data, std::size_t n,
+                                          bool *unordered) {
+  if (n < 4) return max_f32_scalar_(data, n, unordered);
+  __m128 max = _mm_loadu_ps(data);
+  __m128 nan = _mm_cmpunord_ps(max, max);
+  std::size_t i = 4;
+  for (; i + 4 <= n; i += 4) {
+    __m128 block = _mm_loadu_ps(data + i);
+    nan = _mm_or_ps(nan, _mm_cmpunord_ps(block, block));
+    max = _mm_max_ps(max, block);
+  }
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, max);
+  float result = max_scalar_(lanes, 4);
+  bool tail_nan = false;
+  if (i < n) {
+    result = std::max(result, max_f32_scalar_(data + i, n - i, &tail_nan));
+  }
+  *unordered = _mm_movemask_ps(nan) != 0 || tail_nan;
+  return result;
+}
+
+S21_SIMD_SSE2_ inline std::uint64_t sum_u8_sse2_(const std::uint8_t *data,
+                                                 std::size_t n) {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i sum = zero;
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i block = load_sse2_(data + i);
+    sum = _mm_add_epi64(sum, _mm_sad_epu8(block, zero));
+  }
+  alignas(16) std::uint64_t lanes[2];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), sum);
+  return lanes[0] + lanes[1] + sum_scalar_<std::uint64_t>(data + i, n - i);
+}
+
+// Sign-extends to 64-bit lanes (SSE2 has no pmovsxdq)
+S21_SIMD_SSE2_ inline std::int64_t sum_i32_sse2_(const std::int32_t *data,
+                                                 std::size_t n) {
+  __m128i sum = _mm_setzero_si128();
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i block = load_sse2_(data + i);
+    __m128i sign = _mm_srai_epi32(block, 31);
+    sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(block, sign));
+    sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(block, sign));
+  }
+  alignas(16) std::int64_t lanes[2];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), sum);
+  return lanes[0] + lanes[1] + sum_scalar_<std::int64_t>(data + i, n - i);
+}
+
+// Four independent accumulators hide the add latency
+S21_SIMD_SSE2_ inline float sum_f32_sse2_(const float *data, std::size_t n) {
+  __m128 sum[4] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(),
+                   _mm_setzero_ps()};
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    for (int k = 0; k < 4; ++k) {
+      sum[k] = _mm_add_ps(sum[k], _mm_loadu_ps(data + i + 4 * k));
+    }
+  }
+  for (; i + 4 <= n; i += 4) {
+    sum[0] = _mm_add_ps(sum[0], _mm_loadu_ps(data + i));
+  }
+  __m128 total =
+      _mm_add_ps(_mm_add_ps(sum[0], sum[1]), _mm_add_ps(sum[2], sum[3]));
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, total);
+  return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) +
+         sum_scalar_<float>(data + i, n - i);
+}
+
+S21_SIMD_SSE2_ inline bool equal_f32_sse2_(const float *a, const float *b,
+                                           std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 equal = _mm_cmpeq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+    if (_mm_movemask_ps(equal) != 0xF) return false;
+  }
+  return equal_f32_scalar_(a + i, b + i, n - i);
+}
+
+S21_SIMD_SSE2_ inline void fill_u32_sse2_(std::uint32_t *data, std::size_t n,
+                                          std::uint32_t value) {
+  const __m128i block = _mm_set1_epi32(static_cast<int>(value));
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(data + i), block);
+  }
+  fill_u32_scalar_(data + i, n - i, value);
+}
+
+inline constexpr kernels_ kSse2Kernels_ = {
+    find_u8_sse2_,  find_u32_sse2_,  find_f32_sse2_, count_u8_sse2_,
+    count_u32_sse2_, count_f32_sse2_, min_u8_sse2_,   max_u8_sse2_,
+    min_i32_sse2_,  max_i32_sse2_,   min_f32_sse2_,  max_f32_sse2_,
+    sum_u8_sse2_,   sum_i32_sse2_,   sum_f32_sse2_,  equal_f32_sse2_,
+    fill_u32_sse2_,
+};
+
+// AVX2: 32 bytes per step
+
+S21_SIMD_AVX2_ inline __m256i load_avx2_(const void *data) {
+  return _mm256_loadu_si256(static_cast<const __m256i *>(data));
+}
+
+S21_SIMD_AVX2_ inline std::size_t find_u8_avx2_(const std::uint8_t *data,
+                                                std::size_t n,
+                                                std::uint8_t value) {
+  const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    unsigned mask = static_cast<unsigned>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(load_avx2_(data + i), needle)));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i + find_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_AVX2_ inline std::size_t find_u32_avx2_(const std::uint32_t *data,
+                                                 std::size_t n,
+                                                 std::uint32_t value) {
+  const __m256i needle = _mm256_set1_epi32(static_cast<int>(value));
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i equal = _mm256_cmpeq_epi32(load_avx2_(data + i), needle);
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i + find_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_AVX2_ inline std::size_t find_f32_avx2_(const float *data,
+                                                 std::size_t n, float value) {
+  const __m256 needle = _mm256_set1_ps(value);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 equal = _mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ);
+    int mask = _mm256_movemask_ps(equal);
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i + find_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_AVX2_ inline std::size_t count_u8_avx2_(const std::uint8_t *data,
+                                                 std::size_t n,
+                                                 std::uint8_t value) {
+  const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+  const __m256i zero = _mm256_setzero_si256();
+  std::size_t count = 0;
+  std::size_t i = 0;
+  std::size_t vector_end = n / 32 * 32;
+  while (i < vector_end) {
+    std::size_t stop = std::min(vector_end, i + 255 * 32);
+    __m256i hits = zero;
+    for (; i < stop; i += 32) {
+      hits = _mm256_sub_epi8(hits,
+                             _mm256_cmpeq_epi8(load_avx2_(data + i), needle));
+    }
+    alignas(32) std::uint64_t sums[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(sums),
+                       _mm256_sad_epu8(hits, zero));
+    count += sums[0] + sums[1] + sums[2] + sums[3];
+  }
+  return count + count_scalar_(data + i, n - i, value);
+}
+
+// Adds up the eight 32-bit hit counters
+S21_SIMD_AVX2_ inline std::size_t sum_counters_avx2_(__m256i hits) {
+  alignas(32) std::uint32_t lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), hits);
+  return sum_scalar_<std::size_t>(lanes, 8);
+}
+
+S21_SIMD_AVX2_ inline std::size_t count_u32_avx2_(const std::uint32_t *data,
+                                                  std::size_t n,
+                                                  std::uint32_t value) {
+  const __m256i needle = _mm256_set1_epi32(static_cast<int>(value));
+  std::size_t count = 0;
+  std::size_t i = 0;
+  std::size_t vector_end = n / 8 * 8;
+  while (i < vector_end) {
+    std::size_t stop = std::min(vector_end, i + (std::size_t(1) << 30));
+    __m256i hits = _mm256_setzero_si256();
+    for (; i < stop; i += 8) {
+      hits = _mm256_sub_epi32(
+          hits, _mm256_cmpeq_epi32(load_avx2_(data + i), needle));
+    }
+    count += sum_counters_avx2_(hits);
+  }
+  return count + count_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_AVX2_ inline std::size_t count_f32_avx2_(const float *data,
+                                                  std::size_t n, float value) {
+  const __m256 needle = _mm256_set1_ps(value);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  std::size_t vector_end = n / 8 * 8;
+  while (i < vector_end) {
+    std::size_t stop = std::min(vector_end, i + (std::size_t(1) << 30));
+    __m256i hits = _mm256_setzero_si256();
+    for (; i < stop; i += 8) {
+      __m256 equal =
+          _mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ);
+      hits = _mm256_sub_epi32(hits, _mm256_castps_si256(equal));
+    }
+    count += sum_counters_avx2_(hits);
+  }
+  return count + count_scalar_(data + i, n - i, value);
+}
+
+S21_SIMD_AVX2_ inline std::uint8_t min_u8_avx2_(const std::uint8_t *data,
+                                                std::size_t n) {
+  if (n < 32) return min_scalar_(data, n);
+  __m256i min = load_avx2_(data);
+  std::size_t i = 32;
+  for (; i + 32 <= n; i += 32) min = _mm256_min_epu8(min, load_avx2_(data + i));
+  alignas(32) std::uint8_t lanes[32];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), min);
+  std::uint8_t result = min_scalar_(lanes, 32);
+  return i < n ? std::min(result, min_scalar_(data + i, n - i)) : result;
+}
+
+S21_SIMD_AVX2_ inline std::uint8_t max_u8_avx2_(const std::uint8_t *data,
+                                                std::size_t n) {
+  if (n < 32) return max_scalar_(data, n);
+  __m256i max = load_avx2_(data);
+  std::size_t i = 32;
+  for (; i + 32 <= n; i += 32) max = _mm256_max_epu8(max, load_avx2_(data + i));
+  alignas(32) std::uint8_t lanes[32];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), max);
+  std::uint8_t result = max_scalar_(lanes, 32);
+  return i < n ? std::max(result, max_scalar_(data + i, n - i)) : result;
+}
+
+S21_SIMD_AVX2_ inline std::int32_t min_i32_avx2_(const std::int32_t *data,
+                                                 std::size_t n) {
+  if (n < 8) return min_scalar_(data, n);
+  __m256i min = load_avx2_(data);
+  std::size_t i = 8;
+  for (; i + 8 <= n; i += 8) min = _mm256_min_epi32(min, load_avx2_(data + i));
+  alignas(32) std::int32_t lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), min);
+  std::int32_t result = min_scalar_(lanes, 8);
+  return i < n ? std::min(result, min_scalar_(data + i, n - i)) : result;
+}
+
+S21_SIMD_AVX2_ inline std::int32_t max_i32_avx2_(const std::int32_t *data,
+                                                 std::size_t n) {
+  if (n < 8) return max_scalar_(data, n);
+  __m256i max = load_avx2_(data);
+  std::size_t i = 8;
+  for (; i + 8 <= n; i += 8) max = _mm256_max_epi32(max, load_avx2_(data + i));
+  alignas(32) std::int32_t lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), max);
+  std::int32_t result = max_scalar_(lanes, 8);
+  return i < n ? std::max(result, max_scalar_(data + i, n - i)) : result;
+}
+
+S21_SIMD_AVX2_ inline float min_f32_avx2_(const float *data, std::size_t n,
+                                          bool *unordered) {
+  if (n < 8) return min_f32_scalar_(data, n, unordered);
+  __m256 min = _mm256_loadu_ps(data);
+  __m256 nan = _mm256_cmp_ps(min, min, _CMP_UNORD_Q);
+  std::size_t i = 8;
+  for (; i + 8 <= n; i += 8) {
+    __m256 block = _mm256_loadu_ps(data + i);
+    nan = _mm256_or_ps(nan, _mm256_cmp_ps(block, block, _CMP_UNORD_Q));
+    min = _mm256_min_ps(min, block);
+  }
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, min);
+  float result = min_scalar_(lanes, 8);
+  bool tail_nan = false;
+  if (i < n) {
+    result = std::min(result, min_f32_scalar_(data + i, n - i, &tail_nan));
+  }
+  *unordered = _mm256_movemask_ps(nan) != 0 || tail_nan;
+  return result;
+}
+
+S21_SIMD_AVX2_ inline float max_f32_avx2_(const float *data, std::size_t n,
+                                          bool *unordered) {
+  if (n < 8) return max_f32_scalar_(data, n, unordered);
+  __m256 max = _mm256_loadu_ps(data);
+  __m256 nan = _mm256_cmp_ps(max, max, _CMP_UNORD_Q);
+  std::size_t i = 8;
+  for (; i + 8 <= n; i += 8) {
+    __m256 block = _mm256_loadu_ps(data + i);
+    nan = _mm256_or_ps(nan, _mm256_cmp_ps(block, block, _CMP_UNORD_Q));
+    max = _mm256_max_ps(max, block);
+  }
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, max);
+  float result = max_scalar_(lanes, 8);
+  bool tail_nan = false;
+  if (i < n) {
+    result = std::max(result, max_f32_scalar_(data + i, n - i, &tail_nan));
+  }
+  *unordered = _mm256_movemask_ps(nan) != 0 || tail_nan;
+  return result;
+}
+
+S21_SIMD_AVX2_ inline std::uint64_t sum_u8_avx2_(const std::uint8_t *data,
+                                                 std::size_t n) {
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i sum = zero;
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    sum = _mm256_add_epi64(sum, _mm256_sad_epu8(load_avx2_(data + i), zero));
+  }
+  alignas(32) std::uint64_t lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), sum);
+  return sum_scalar_<std::uint64_t>(lanes, 4) +
+         sum_scalar_<std::uint64_t>(data + i, n - i);
+}
+
+S21_SIMD_AVX2_ inline std::int64_t sum_i32_avx2_(const std::int32_t *data,
+                                                 std::size_t n) {
+  __m256i low = _mm256_setzero_si256();
+  __m256i high = _mm256_setzero_si256();
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i block = load_avx2_(data + i);
+    low = _mm256_add_epi64(
+        low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+    high = _mm256_add_epi64(
+        high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+  }
+  alignas(32) std::int64_t lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes),
+                     _mm256_add_epi64(low, high));
+  return sum_scalar_<std::int64_t>(lanes, 4) +
+         sum_scalar_<std::int64_t>(data + i, n - i);
+}
+
+S21_SIMD_AVX2_ inline float sum_f32_avx2_(const float *data, std::size_t n) {
+  __m256 sum[4] = {_mm256_setzero_ps(), _mm256_setzero_ps(),
+                   _mm256_setzero_ps(), _mm256_setzero_ps()};
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    for (int k = 0; k < 4; ++k) {
+      sum[k] = _mm256_add_ps(sum[k], _mm256_loadu_ps(data + i + 8 * k));
+    }
+  }
+  for (; i + 8 <= n; i += 8) {
+    sum[0] = _mm256_add_ps(sum[0], _mm256_loadu_ps(data + i));
+  }
+  __m256 total = _mm256_add_ps(_mm256_add_ps(sum[0], sum[1]),
+                               _mm256_add_ps(sum[2], sum[3]));
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, total);
+  return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+         ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7])) +
+         sum_scalar_<float>(data + i, n - i);
+}
+
+S21_SIMD_AVX2_ inline bool equal_f32_avx2_(const float *a, const float *b,
+                                           std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 equal = _mm256_cmp_ps(_mm256_loadu_ps(a + i),
+                                 _mm256_loadu_ps(b + i), _CMP_EQ_OQ);
+    if (_mm256_movemask_ps(equal) != 0xFF) return false;
+  }
+  return equal_f32_scalar_(a + i, b + i, n - i);
+}
+
+S21_SIMD_AVX2_ inline void fill_u32_avx2_(std::uint32_t *data, std::size_t n,
+                                          std::uint32_t value) {
+  const __m256i block = _mm256_set1_epi32(static_cast<int>(value));
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + i), block);
+  }
+  fill_u32_scalar_(data + i, n - i, value);
+}
+
+inline constexpr kernels_ kAvx2Kernels_ = {
+    find_u8_avx2_,  find_u32_avx2_,  find_f32_avx2_, count_u8_avx2_,
+    count_u32_avx2_, count_f32_avx2_, min_u8_avx2_,   max_u8_avx2_,
+    min_i32_avx2_,  max_i32_avx2_,   min_f32_avx2_,  max_f32_avx2_,
+    sum_u8_avx2_,   sum_i32_avx2_,   sum_f32_avx2_,  equal_f32_avx2_,
+    fill_u32_avx2_,
+};
+#endif
+
+// The best instruction set this CPU runs
+inline isa supported_isa() noexcept {
+#if S21_SIMD_X86_
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return isa::avx2;
+  if (__builtin_cpu_supports("sse2")) return isa::sse2;
+#endif
+  return isa::scalar;
+}
+
+inline const kernels_ &kernels_for_(isa level) noexcept {
+#if S21_SIMD_X86_
+  if (level == isa::avx2) return kAvx2Kernels_;
+  if (level == isa::sse2) return kSse2Kernels_;
+#endif
+  (void)level;
+  return kScalarKernels_;
+}
+
+inline std::atomic<isa> &active_isa_() noexcept {
+  static std::atomic<isa> active{supported_isa()};
+  return active;
+}
+
+// The instruction set the algorithms dispatch to, supported_isa() unless
+// set_isa() lowered it
+inline isa active_isa() noexcept {
+  return active_isa_().load(std::memory_order_relaxed);
+}
+
+// Dispatches to level, or to supported_isa() if the CPU lacks it; for tests
+// and for benchmarks against the scalar kernels
+inline void set_isa(isa level) noexcept {
+  active_isa_().store(std::min(level, supported_isa()),
+                      std::memory_order_relaxed);
+}
+
+inline const kernels_ &active_kernels_() noexcept {
+  return kernels_for_(active_isa());
+}
+
+// Element types the kernels handle: equality kernels compare the bytes of
+// 1- and 4-byte integers, float has its own; ordering and sums are for
+// std::uint8_t, std::int32_t and float
+template <typename T>
+inline constexpr bool kBytes_ = std::is_integral<T>::value && sizeof(T) == 1;
+
+template <typename T>
+inline constexpr bool kWords_ = std::is_integral<T>::value && sizeof(T) == 4;
+
+template <typename T>
+inline constexpr bool kOrdered_ = std::is_same<T, std::uint8_t>::value ||
+                                  std::is_same<T, std::int32_t>::value ||
+                                  std::is_same<T, float>::value;
+
+// Element type of a contiguous container
+template <class Container>
+using element_of_ = std::remove_const_t<
+    std::remove_pointer_t<decltype(std::declval<Container &>().data())>>;
+
+// First element equal to value, or last
+template <typename T>
+T *find(T *first, T *last, const std::remove_const_t<T> &value) {
+  using U = std::remove_const_t<T>;
+  std::size_t n = last - first;
+  if constexpr (std::is_same<U, float>::value) {
+    return first + active_kernels_().find_f32(first, n, value);
+  } else if constexpr (kWords_<U>) {
+    return first + active_kernels_().find_u32(
+                       reinterpret_cast<const std::uint32_t *>(first), n,
+                       static_cast<std::uint32_t>(value));
+  } else if constexpr (kBytes_<U>) {
+    return first + active_kernels_().find_u8(
+                       reinterpret_cast<const std::uint8_t *>(first), n,
+                       static_cast<std::uint8_t>(value));
+  } else {
+    return std::find(first, last, value);
+  }
+}
+
+// Number of elements equal to value
+template <typename T>
+std::size_t count(const T *first, const T *last, const T &value) {
+  std::size_t n = last - first;
+  if constexpr (std::is_same<T, float>::value) {
+    return active_kernels_().count_f32(first, n, value);
+  } else if constexpr (kWords_<T>) {
+    return active_kernels_().count_u32(
+        reinterpret_cast<const std::uint32_t *>(first), n,
+        static_cast<std::uint32_t>(value));
+  } else if constexpr (kBytes_<T>) {
+    return active_kernels_().count_u8(
+        reinterpret_cast<const std::uint8_t *>(first), n,
+        static_cast<std::uint8_t>(value));
+  } else {
+    return std::count(first, last, value);
+  }
+}
+
+// First smallest element, or last if the range is empty. The kernels find
+// the smallest value and find() its first occurrence; float ranges holding
+// a NaN fall back to std::min_element, so the result is always the same.
+template <typename T>
+T *min_element(T *first, T *last) {
+  using U = std::remove_const_t<T>;
+  if constexpr (kOrdered_<U>) {
+    if (first == last) return last;
+    std::size_t n = last - first;
+    if constexpr (std::is_same<U, float>::value) {
+      bool unordered = false;
+      float min = active_kernels_().min_f32(first, n, &unordered);
+      return unordered ? std::min_element(first, last) : find(first, last, min);
+    } else if constexpr (std::is_same<U, std::int32_t>::value) {
+      return find(first, last, active_kernels_().min_i32(first, n));
+    } else {
+      return find(first, last, active_kernels_().min_u8(first, n));
+    }
+  } else {
+    return std::min_element(first, last);
+  }
+}
+
+// First largest element, or last if the range is empty; see min_element
+template <typename T>
+T *max_element(T *first, T *last) {
+  using U = std::remove_const_t<T>;
+  if constexpr (kOrdered_<U>) {
+    if (first == last) return last;
+    std::size_t n = last - first;
+    if constexpr (std::is_same<U, float>::value) {
+      bool unordered = false;
+      float max = active_kernels_().max_f32(first, n, &unordered);
+      return unordered ? std::max_element(first, last) : find(first, last, max);
+    } else if constexpr (std::is_same<U, std::int32_t>::value) {
+      return find(first, last, active_kernels_().max_i32(first, n));
+    } else {
+      return find(first, last, active_kernels_().max_u8(first, n));
+    }
+  } else {
+    return std::max_element(first, last);
+  }
+}
+
+// init plus the sum of the elements. Integers are summed exactly in 64 bits
+// and then converted to Init. Floats with a float init are summed in float
+// across several lanes, an order that rounds differently from
+// std::accumulate; a wider Init, such as double, goes through
+// std::accumulate so every addition keeps its precision.
+template <typename T, typename Init>
+Init accumulate(const T *first, const T *last, Init init) {
+  std::size_t n = last - first;
+  if constexpr (std::is_same<T, float>::value &&
+                std::is_same<Init, float>::value) {
+    return static_cast<Init>(init + active_kernels_().sum_f32(first, n));
+  } else if constexpr (std::is_same<T, std::int32_t>::value) {
+    return static_cast<Init>(init + active_kernels_().sum_i32(first, n));
+  } else if constexpr (std::is_same<T, std::uint8_t>::value) {
+    return static_cast<Init>(init + active_kernels_().sum_u8(first, n));
+  } else {
+    return std::accumulate(first, last, init);
+  }
+}
+
+// Whether [first1, last1) equals the range starting at first2
+template <typename T>
+bool equal(const T *first1, const T *last1, const T *first2) {
+  std::size_t n = last1 - first1;
+  if constexpr (std::is_same<T, float>::value) {
+    return active_kernels_().equal_f32(first1, first2, n);
+  } else if constexpr (kWords_<T> || kBytes_<T>) {
+    return n == 0 || std::memcmp(first1, first2, n * sizeof(T)) == 0;
+  } else {
+    return std::equal(first1, last1, first2);
+  }
+}
+
+// Assigns value to every element
+template <typename T>
+void fill(T *first, T *last, const T &value) {
+  std::size_t n = last - first;
+  if constexpr (kWords_<T> || std::is_same<T, float>::value) {
+    std::uint32_t word;
+    std::memcpy(&word, &value, sizeof(word));
+    active_kernels_().fill_u32(reinterpret_cast<std::uint32_t *>(first), n,
+                               word);
+  } else if constexpr (kBytes_<T>) {
+    if (n) std::memset(first, static_cast<unsigned char>(value), n);
+  } else {
+    std::fill(first, last, value);
+  }
+}
+
+// The same algorithms over a whole contiguous container
+
+template <class Container>
+auto find(Container &c, const element_of_<Container> &value)
+    -> decltype(c.data()) {
+  return simd::find(c.data(), c.data() + c.size(), value);
+}
+
+template <class Container>
+std::size_t count(const Container &c, const element_of_<Container> &value) {
+  return simd::count(c.data(), c.data() + c.size(), value);
+}
+
+template <class Container>
+auto min_element(Container &c) -> decltype(c.data()) {
+  return simd::min_element(c.data(), c.data() + c.size());
+}
+
+template <class Container>
+auto max_element(Container &c) -> decltype(c.data()) {
+  return simd::max_element(c.data(), c.data() + c.size());
+}
+
+template <class Container, typename Init>
+Init accumulate(const Container &c, Init init) {
+  return simd::accumulate(c.data(), c.data() + c.size(), init);
+}
+
+template <class Container1, class Container2>
+bool equal(const Container1 &a, const Container2 &b) {
+  return a.size() == b.size() &&
+         simd::equal(a.data(), a.data() + a.size(), b.data());
+}
+
+template <class Container>
+void fill(Container &c, const element_of_<Container> &value) {
+  simd::fill(c.data(), c.data() + c.size(), value);
+}
+}  // namespace simd
+}  // namespace s21
+
+#undef S21_SIMD_SSE2_
+#undef S21_SIMD_AVX2_
+#undef S21_SIMD_X86_
+
+#endif
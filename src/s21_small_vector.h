@@ -0,0 +1,401 @@
+#ifndef S21_SMALL_VECTOR_H_
+#define S21_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_memory.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// s21::vector that keeps up to N elements in an inline buffer and moves
+// them to the heap only when more are needed, so short temporaries never
+// allocate. Once on the heap it grows by Growth like s21::vector, and
+// shrink_to_fit brings the elements back inline when they fit again.
+// Moving or swapping a heap-backed small_vector hands over the buffer;
+// inline elements are relocated one buffer to the other (a memcpy for
+// trivially relocatable T).
+template <typename T, std::size_t N, class Growth = doubling_growth>
+class small_vector : private vector_elements_<T> {
+  static_assert(N > 0, "small_vector needs an inline capacity; use vector");
+
+  using elements = vector_elements_<T>;
+  using elements::allocate;
+  using elements::copy_construct;
+  using elements::deallocate;
+  using elements::destroy;
+  using elements::kReallocates;
+  using elements::relocate;
+
+ public:
+  using size_type = std::size_t;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  static constexpr size_type kInlineCapacity = N;
+
+  small_vector() noexcept : data_(inline_data()), size_(0), capacity_(N) {}
+
+  explicit small_vector(size_type n) : small_vector() { resize(n); }
+
+  small_vector(std::initializer_list<value_type> const &items)
+      : small_vector() {
+    insert(end(), items.begin(), items.end());
+  }
+
+  small_vector(const small_vector &other) : small_vector() {
+    reserve(other.size_);
+    copy_construct(other.data_, other.size_, data_);
+    size_ = other.size_;
+  }
+
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value)
+      : small_vector() {
+    take(other);
+  }
+
+  ~small_vector() {
+    clear();
+    if (!is_inline()) deallocate(data_);
+  }
+
+  small_vector &operator=(const small_vector &other) {
+    if (this != &other) {
+      small_vector temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  small_vector &operator=(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+      clear();
+      if (!other.is_inline() && !is_inline()) {
+        deallocate(data_);
+        data_ = inline_data();
+        capacity_ = N;
+      }
+      take(other);
+    }
+    return *this;
+  }
+
+  reference operator[](size_type index) { return data_[index]; }
+
+  const_reference operator[](size_type index) const { return data_[index]; }
+
+  reference at(size_type index) {
+    if (index >= size_) throw std::out_of_range("out of range");
+    return data_[index];
+  }
+
+  const_reference front() const { return data_[0]; }
+
+  const_reference back() const { return data_[size_ - 1]; }
+
+  T *data() noexcept { return data_; }
+
+  const T *data() const noexcept { return data_; }
+
+  iterator begin() noexcept { return data_; }
+
+  iterator end() noexcept { return data_ + size_; }
+
+  const_iterator begin() const noexcept { return data_; }
+
+  const_iterator end() const noexcept { return data_ + size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<size_type>::max() / sizeof(value_type)) / 2;
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  // Whether the elements are in the inline buffer
+  bool is_inline() const noexcept { return data_ == inline_data(); }
+
+  void reserve(size_type new_capacity) {
+    if (new_capacity <= capacity_) return;
+    if (new_capacity > max_size()) {
+      throw std::length_error("new capacity greater than maximum capacity");
+    }
+    reallocate(new_capacity);
+  }
+
+  // Reports the heap buffer, which is empty while the elements are inline
+  memory_report memory_usage() const {
+    memory_report report;
+    if (!is_inline()) {
+      report.payload_bytes = size_ * sizeof(T);
+      report.overhead_bytes = (capacity_ - size_) * sizeof(T);
+      report.allocations = 1;
+    }
+    return report;
+  }
+
+  void resize(size_type new_size) {
+    if (new_size < size_) {
+      destroy(data_ + new_size, size_ - new_size);
+    } else if (new_size > size_) {
+      reserve(new_size);
+      for (size_type i = size_; i < new_size; ++i) new (&data_[i]) T();
+    }
+    size_ = new_size;
+  }
+
+  // Frees unused heap memory, moving the elements back inline if they fit
+  void shrink_to_fit() {
+    if (!is_inline() && size_ < capacity_) reallocate(size_);
+  }
+
+  void clear() noexcept {
+    destroy(data_, size_);
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    if (aliases(value)) return insert(pos, count, T(value));
+    return construct_gap(pos - begin(), count, [&](T *first, size_type &built) {
+      for (; built < count; ++built) new (&first[built]) T(value);
+    });
+  }
+
+  // The range must not be part of this small_vector
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = pos - begin();
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  category>::value) {
+      size_type count = std::distance(first, last);
+      return construct_gap(index, count, [&](T *slots, size_type &built) {
+        for (; built < count; ++built, ++first) new (&slots[built]) T(*first);
+      });
+    } else {
+      size_type old_size = size_;
+      for (; first != last; ++first) emplace_back(*first);
+      std::rotate(begin() + index, begin() + old_size, end());
+      return begin() + index;
+    }
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if ((aliases(args) || ...)) {
+      return emplace(pos, T(std::forward<Args>(args)...));
+    }
+    return construct_gap(pos - begin(), 1, [&](T *slot, size_type &built) {
+      new (slot) T(std::forward<Args>(args)...);
+      built = 1;
+    });
+  }
+
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = first - begin();
+    size_type count = last - first;
+    if (count) {
+      destroy(data_ + index, count);
+      relocate(data_ + index + count, size_ - index - count, data_ + index);
+      size_ -= count;
+    }
+    return begin() + index;
+  }
+
+  void push_back(const T &value) { emplace_back(value); }
+
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  void emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      if ((aliases(args) || ...)) {
+        return emplace_back(T(std::forward<Args>(args)...));
+      }
+      reallocate(grown_capacity(size_ + 1));
+    }
+    new (&data_[size_]) T(std::forward<Args>(args)...);
+    ++size_;
+  }
+
+  void pop_back() {
+    if (size_ > 0) data_[--size_].~T();
+  }
+
+  // Exchanges heap buffers in O(1); inline elements are moved
+  void swap(small_vector &other) {
+    if (!is_inline() && !other.is_inline()) {
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+    } else {
+      small_vector temp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(temp);
+    }
+  }
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    if ((aliases(args) || ...)) {
+      return insert_many(pos, T(std::forward<Args>(args))...);
+    }
+    iterator it = construct_gap(
+        pos - begin(), sizeof...(Args),
+        [&]([[maybe_unused]] T *first, [[maybe_unused]] size_type &built) {
+          ((new (&first[built]) T(std::forward<Args>(args)), ++built), ...);
+        });
+    return it + sizeof...(Args);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (push_back(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  T *data_;
+  size_type size_;
+  size_type capacity_;
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+  T *inline_data() noexcept { return reinterpret_cast<T *>(buffer_); }
+
+  const T *inline_data() const noexcept {
+    return reinterpret_cast<const T *>(buffer_);
+  }
+
+  // Takes the elements of other, whose storage is left empty and inline;
+  // this must be empty with room for other's elements if they are inline
+  void take(small_vector &other) {
+    if (other.is_inline()) {
+      relocate(other.data_, other.size_, data_);
+    } else {
+      data_ = other.data_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inline_data();
+      other.capacity_ = N;
+    }
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+
+  // Moves the elements to the inline buffer if new_capacity fits in it,
+  // otherwise to a heap buffer of new_capacity elements
+  void reallocate(size_type new_capacity) {
+    if (new_capacity <= N) {
+      if (is_inline()) return;
+      T *heap = data_;
+      relocate(heap, size_, inline_data());
+      deallocate(heap);
+      data_ = inline_data();
+      capacity_ = N;
+      return;
+    }
+    if constexpr (kReallocates) {
+      if (!is_inline()) {
+        void *memory = std::realloc(static_cast<void *>(data_),
+                                    new_capacity * sizeof(T));
+        if (!memory) throw std::bad_alloc();
+        data_ = static_cast<T *>(memory);
+        capacity_ = new_capacity;
+        return;
+      }
+    }
+    T *new_data = allocate(new_capacity);
+    relocate(data_, size_, new_data);
+    if (!is_inline()) deallocate(data_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  size_type grown_capacity(size_type required) const {
+    if (required > max_size()) {
+      throw std::length_error("new capacity greater than maximum capacity");
+    }
+    size_type proposed = Growth::next_capacity(capacity_, required, sizeof(T));
+    return std::min(std::max(required, proposed), max_size());
+  }
+
+  template <typename U>
+  bool aliases(const U &value) const noexcept {
+    if constexpr (std::is_same<std::decay_t<U>, T>::value) {
+      return std::greater_equal<const T *>()(&value, data_) &&
+             std::less<const T *>()(&value, data_ + size_);
+    } else {
+      return false;
+    }
+  }
+
+  // As in s21::vector: opens count slots at index, moving the tail once,
+  // and builds the new elements there; restores the elements if build
+  // throws
+  template <typename Build>
+  iterator construct_gap(size_type index, size_type count, Build build) {
+    if (count == 0) return data_ + index;
+    size_type built = 0;
+    if (size_ + count > capacity_) {
+      size_type new_capacity = grown_capacity(size_ + count);
+      if constexpr (kReallocates) {
+        reallocate(new_capacity);
+      } else {
+        T *new_data = allocate(new_capacity);
+        try {
+          build(new_data + index, built);
+        } catch (...) {
+          destroy(new_data + index, built);
+          deallocate(new_data);
+          throw;
+        }
+        relocate(data_, index, new_data);
+        relocate(data_ + index, size_ - index, new_data + index + count);
+        if (!is_inline()) deallocate(data_);
+        data_ = new_data;
+        capacity_ = new_capacity;
+        size_ += count;
+        return data_ + index;
+      }
+    }
+    relocate(data_ + index, size_ - index, data_ + index + count);
+    try {
+      build(data_ + index, built);
+    } catch (...) {
+      destroy(data_ + index, built);
+      relocate(data_ + index + count, size_ - index, data_ + index);
+      throw;
+    }
+    size_ += count;
+    return data_ + index;
+  }
+};
+}  // namespace s21
+
+#endif
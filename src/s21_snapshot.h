@@ -0,0 +1,244 @@
+#ifndef S21_SNAPSHOT_H_
+#define S21_SNAPSHOT_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace s21 {
+enum class snapshot_kind : std::uint32_t { set = 1, map = 2, multiset = 3 };
+
+// 64-bit FNV-1a over 8-byte little words, fed in arbitrary pieces
+class snapshot_checksum {
+  std::uint64_t hash_ = 14695981039346656037ull;
+  unsigned char tail_[8] = {};
+  std::size_t tail_size_ = 0;
+
+  void mix(const unsigned char *word) noexcept {
+    std::uint64_t value;
+    std::memcpy(&value, word, sizeof(value));
+    hash_ = (hash_ ^ value) * 1099511628211ull;
+  }
+
+ public:
+  void update(const void *data, std::size_t size) noexcept {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    while (size && tail_size_) {
+      tail_[tail_size_++] = *bytes++;
+      --size;
+      if (tail_size_ == sizeof(tail_)) {
+        mix(tail_);
+        tail_size_ = 0;
+      }
+    }
+    for (; size >= sizeof(tail_); bytes += sizeof(tail_), size -= sizeof(tail_))
+      mix(bytes);
+    while (size--) tail_[tail_size_++] = *bytes++;
+  }
+
+  std::uint64_t value() const noexcept {
+    snapshot_checksum rest = *this;
+    if (rest.tail_size_) {
+      std::memset(rest.tail_ + rest.tail_size_, 0,
+                  sizeof(tail_) - rest.tail_size_);
+      rest.mix(rest.tail_);
+    }
+    return rest.hash_;
+  }
+};
+
+// Read-only memory mapping of a validated snapshot file.
+//
+// Layout (native byte order):
+//   header (64 bytes) | keys[count + 1] | pad | values[count + 1] | pad
+// Both arrays start on a 64-byte boundary and hold the entries in Eytzinger
+// order with slot 0 unused, so the mapping can be searched in place. The
+// checksum covers everything after the header; the file length is a
+// multiple of 8.
+class snapshot_file {
+ public:
+  static constexpr std::uint32_t kVersion = 1;
+  static constexpr std::uint64_t kAlignment = 64;
+
+  struct header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t kind;
+    std::uint32_t key_size;
+    std::uint32_t value_size;
+    std::uint64_t count;
+    std::uint64_t values_offset;
+    std::uint64_t file_size;
+    std::uint64_t checksum;
+  };
+
+  snapshot_file(const std::string &path, snapshot_kind kind,
+                std::uint32_t key_size, std::uint32_t value_size,
+                bool verify = true) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("cannot open snapshot " + path);
+    struct stat info;
+    if (::fstat(fd, &info) != 0 ||
+        static_cast<std::uint64_t>(info.st_size) < kAlignment) {
+      ::close(fd);
+      throw std::runtime_error("truncated snapshot " + path);
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+    void *base = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) throw std::runtime_error("cannot map " + path);
+    base_ = static_cast<const unsigned char *>(base);
+    try {
+      validate(kind, key_size, value_size, verify);
+    } catch (...) {
+      ::munmap(const_cast<unsigned char *>(base_), size_);
+      throw;
+    }
+  }
+
+  snapshot_file(const snapshot_file &) = delete;
+  snapshot_file &operator=(const snapshot_file &) = delete;
+
+  ~snapshot_file() { ::munmap(const_cast<unsigned char *>(base_), size_); }
+
+  std::uint64_t count() const noexcept { return info().count; }
+
+  const void *keys() const noexcept { return base_ + kAlignment; }
+
+  const void *values() const noexcept {
+    return base_ + info().values_offset;
+  }
+
+  // Writes count + 1 Eytzinger slots of keys and, unless value_size is 0,
+  // of values. The file is written to a unique temporary next to path,
+  // synced, and renamed into place, and the directory is synced after, so
+  // readers never observe a partial snapshot, concurrent writers do not
+  // share a temporary, and a crash leaves either the old or the new file.
+  static void write(const std::string &path, snapshot_kind kind,
+                    std::uint64_t count, const void *keys,
+                    std::uint32_t key_size, const void *values,
+                    std::uint32_t value_size) {
+    header head = {};
+    std::memcpy(head.magic, kMagic, sizeof(head.magic));
+    head.version = kVersion;
+    head.kind = static_cast<std::uint32_t>(kind);
+    head.key_size = key_size;
+    head.value_size = value_size;
+    head.count = count;
+    head.values_offset = align(kAlignment + (count + 1) * key_size, kAlignment);
+    head.file_size = align(head.values_offset + (count + 1) * value_size, 8);
+
+    std::string temp_path = path + ".XXXXXX";
+    int fd = ::mkstemp(&temp_path[0]);
+    if (fd < 0) throw std::runtime_error("cannot create snapshot " + path);
+    // mkstemp creates the file 0600; readers may be other users
+    std::FILE *file = ::fchmod(fd, 0644) == 0 ? ::fdopen(fd, "wb") : nullptr;
+    if (!file) {
+      ::close(fd);
+      std::remove(temp_path.c_str());
+      throw std::runtime_error("cannot create snapshot " + path);
+    }
+    snapshot_checksum checksum;
+    bool ok = put(file, &head, sizeof(head), nullptr) &&
+              pad(file, kAlignment, nullptr) &&
+              put(file, keys, (count + 1) * key_size, &checksum) &&
+              pad(file, head.values_offset, &checksum) &&
+              put(file, values, (count + 1) * value_size, &checksum) &&
+              pad(file, head.file_size, &checksum);
+    head.checksum = checksum.value();
+    ok = ok && std::fseek(file, 0, SEEK_SET) == 0 &&
+         put(file, &head, sizeof(head), nullptr) && std::fflush(file) == 0 &&
+         ::fsync(::fileno(file)) == 0;
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+      std::remove(temp_path.c_str());
+      throw std::runtime_error("cannot write snapshot " + path);
+    }
+    if (!sync_directory(path)) {
+      throw std::runtime_error("cannot sync directory of snapshot " + path);
+    }
+  }
+
+ private:
+  static constexpr char kMagic[8] = "S21SNAP";
+
+  const unsigned char *base_ = nullptr;
+  std::size_t size_ = 0;
+
+  const header &info() const noexcept {
+    return *reinterpret_cast<const header *>(base_);
+  }
+
+  static std::uint64_t align(std::uint64_t offset, std::uint64_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+  }
+
+  // Makes the rename of path durable
+  static bool sync_directory(const std::string &path) {
+    std::string::size_type slash = path.rfind('/');
+    std::string directory = slash == std::string::npos ? "."
+                            : slash == 0               ? "/"
+                                                       : path.substr(0, slash);
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return false;
+    bool ok = ::fsync(fd) == 0;
+    return ::close(fd) == 0 && ok;
+  }
+
+  // a null data pointer writes zeros
+  static bool put(std::FILE *file, const void *data, std::uint64_t size,
+                  snapshot_checksum *checksum) {
+    static const unsigned char zeros[kAlignment] = {};
+    while (!data && size > kAlignment) {
+      if (!put(file, zeros, kAlignment, checksum)) return false;
+      size -= kAlignment;
+    }
+    if (!data) data = zeros;
+    if (checksum) checksum->update(data, size);
+    return !size || std::fwrite(data, 1, size, file) == size;
+  }
+
+  static bool pad(std::FILE *file, std::uint64_t offset,
+                  snapshot_checksum *checksum) {
+    long position = std::ftell(file);
+    return position >= 0 &&
+           put(file, nullptr, offset - static_cast<std::uint64_t>(position),
+               checksum);
+  }
+
+  void validate(snapshot_kind kind, std::uint32_t key_size,
+                std::uint32_t value_size, bool verify) const {
+    const header &head = info();
+    if (std::memcmp(head.magic, kMagic, sizeof(head.magic)) != 0)
+      throw std::runtime_error("not an s21 snapshot");
+    if (head.version != kVersion)
+      throw std::runtime_error("unsupported snapshot version");
+    if (head.kind != static_cast<std::uint32_t>(kind) ||
+        head.key_size != key_size || head.value_size != value_size)
+      throw std::runtime_error("snapshot holds a different container type");
+    std::uint64_t keys_end = kAlignment + (head.count + 1) * key_size;
+    if (head.file_size != size_ || head.count > size_ ||
+        head.values_offset != align(keys_end, kAlignment) ||
+        head.file_size !=
+            align(head.values_offset + (head.count + 1) * value_size, 8))
+      throw std::runtime_error("corrupted snapshot layout");
+    if (verify) {
+      snapshot_checksum checksum;
+      checksum.update(base_ + kAlignment, size_ - kAlignment);
+      if (checksum.value() != head.checksum)
+        throw std::runtime_error("snapshot checksum mismatch");
+    }
+  }
+};
+}  // namespace s21
+
+#endif
@@ -8,13 +8,13 @@
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class stack {
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
-  using container_type = s21::vector<value_type>;
+  using container_type = s21::vector<value_type, Allocator>;
 
  private:
   container_type container_;
@@ -22,6 +22,9 @@ class stack {
  public:
   stack() {}
 
+  // stack whose vector draws memory from alloc
+  explicit stack(const Allocator &alloc) : container_(alloc) {}
+
   stack(std::initializer_list<value_type> const &items) {
     for (const auto &item : items) {
       push(item);
@@ -32,7 +35,7 @@ class stack {
   stack(const stack &s) : container_(s.container_) {}
 
   // move constructor
-  stack(stack &&s) noexcept { swap(s); }
+  stack(stack &&s) noexcept : container_(std::move(s.container_)) {}
 
   // destructor
   ~stack() {}
@@ -62,6 +65,9 @@ class stack {
   // returns the number of elements
   size_type size() { return container_.size(); }
 
+  // reports the memory of the underlying container
+  memory_report memory_usage() const { return container_.memory_usage(); }
+
   // inserts element at the top
   void push(const_reference value) { container_.push_back(value); }
 
@@ -70,9 +76,7 @@ class stack {
 
   // swaps the contents
   void swap(stack &other) {
-    container_type d = container_;
-    container_ = other.container_;
-    other.container_ = d;
+    container_.swap(other.container_);
   }
 
   // Appends new elements to the end of the container
@@ -0,0 +1,441 @@
+#ifndef S21_STATIC_VECTOR_H_
+#define S21_STATIC_VECTOR_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_memory.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Inline storage and size of a static_vector. Trivial elements live in a
+// value-initialized array and are assigned in place, which keeps every
+// operation usable in constant expressions and the storage trivially
+// destructible (a literal type).
+template <typename T, std::size_t N,
+          bool = std::is_trivial<T>::value &&
+                 std::is_trivially_copy_assignable<T>::value>
+struct static_vector_storage_ {
+  static constexpr bool kConstexpr = true;
+
+  T elements_[N ? N : 1]{};
+  std::size_t size_ = 0;
+
+  constexpr T *data() noexcept { return elements_; }
+
+  constexpr const T *data() const noexcept { return elements_; }
+};
+
+// Other elements are constructed with placement new into raw bytes, which
+// stay uninitialized past size, and destroyed with the storage
+template <typename T, std::size_t N>
+struct static_vector_storage_<T, N, false> {
+  static constexpr bool kConstexpr = false;
+
+  alignas(T) unsigned char bytes_[(N ? N : 1) * sizeof(T)];
+  std::size_t size_ = 0;
+
+  static_vector_storage_() noexcept = default;
+  static_vector_storage_(const static_vector_storage_ &) = delete;
+  static_vector_storage_ &operator=(const static_vector_storage_ &) = delete;
+
+  ~static_vector_storage_() { vector_elements_<T>::destroy(data(), size_); }
+
+  T *data() noexcept { return reinterpret_cast<T *>(bytes_); }
+
+  const T *data() const noexcept {
+    return reinterpret_cast<const T *>(bytes_);
+  }
+};
+
+// s21::vector with a fixed capacity of N elements stored inline: it never
+// touches the heap. Growing past N throws std::length_error and leaves the
+// vector unchanged. For trivial T every member is constexpr; other element
+// types get the same interface at run time.
+template <typename T, std::size_t N>
+class static_vector : private static_vector_storage_<T, N>,
+                      private vector_elements_<T> {
+  using storage = static_vector_storage_<T, N>;
+  using elements = vector_elements_<T>;
+  using storage::size_;
+
+ public:
+  using size_type = std::size_t;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  constexpr static_vector() noexcept = default;
+
+  constexpr explicit static_vector(size_type n) { resize(n); }
+
+  constexpr static_vector(std::initializer_list<value_type> const &items) {
+    insert(end(), items.begin(), items.end());
+  }
+
+  constexpr static_vector(const static_vector &other) {
+    for (const T &item : other) emplace_back(item);
+  }
+
+  // Moves the elements one by one; other is left empty
+  constexpr static_vector(static_vector &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value) {
+    take(other);
+  }
+
+  constexpr static_vector &operator=(const static_vector &other) {
+    if (this != &other) {
+      clear();
+      for (const T &item : other) emplace_back(item);
+    }
+    return *this;
+  }
+
+  constexpr static_vector &operator=(static_vector &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+      clear();
+      take(other);
+    }
+    return *this;
+  }
+
+  constexpr reference operator[](size_type index) { return data()[index]; }
+
+  constexpr const_reference operator[](size_type index) const {
+    return data()[index];
+  }
+
+  constexpr reference at(size_type index) {
+    if (index >= size_) throw std::out_of_range("out of range");
+    return data()[index];
+  }
+
+  constexpr const_reference at(size_type index) const {
+    if (index >= size_) throw std::out_of_range("out of range");
+    return data()[index];
+  }
+
+  constexpr const_reference front() const { return data()[0]; }
+
+  constexpr const_reference back() const { return data()[size_ - 1]; }
+
+  constexpr T *data() noexcept { return storage::data(); }
+
+  constexpr const T *data() const noexcept { return storage::data(); }
+
+  constexpr iterator begin() noexcept { return data(); }
+
+  constexpr iterator end() noexcept { return data() + size_; }
+
+  constexpr const_iterator begin() const noexcept { return data(); }
+
+  constexpr const_iterator end() const noexcept { return data() + size_; }
+
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr bool full() const noexcept { return size_ == N; }
+
+  constexpr size_type size() const noexcept { return size_; }
+
+  constexpr size_type max_size() const noexcept { return N; }
+
+  constexpr size_type capacity() const noexcept { return N; }
+
+  // Only checks that new_capacity fits
+  constexpr void reserve(size_type new_capacity) const {
+    if (new_capacity > N) throw std::length_error("static_vector is full");
+  }
+
+  constexpr void shrink_to_fit() noexcept {}
+
+  // Always empty: the elements live inside the object
+  constexpr memory_report memory_usage() const noexcept { return {}; }
+
+  constexpr void resize(size_type new_size) {
+    reserve(new_size);
+    if (new_size < size_) {
+      destroy_tail(new_size);
+    } else {
+      for (; size_ < new_size; ++size_) construct(data() + size_);
+    }
+  }
+
+  constexpr void clear() noexcept { destroy_tail(0); }
+
+  constexpr iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  constexpr iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  constexpr iterator insert(const_iterator pos, size_type count,
+                            const_reference value) {
+    if constexpr (storage::kConstexpr) {
+      const T item = value;  // value may be an element the gap moves
+      return fill_gap(pos, count, item);
+    } else {
+      if (aliases(value)) return insert(pos, count, T(value));
+      return fill_gap(pos, count, value);
+    }
+  }
+
+  // The range must not be part of this static_vector
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  category>::value) {
+      size_type count = std::distance(first, last);
+      return construct_gap(pos, count, [&](T *slots, size_type &built) {
+        for (; built < count; ++built, ++first) {
+          construct(slots + built, *first);
+        }
+      });
+    } else {
+      size_type index = pos - begin();
+      size_type old_size = size_;
+      if constexpr (storage::kConstexpr) {
+        for (; first != last; ++first) {
+          if (full()) {
+            destroy_tail(old_size);
+            throw std::length_error("static_vector is full");
+          }
+          emplace_back(*first);
+        }
+      } else {
+        append_or_undo(first, last);
+      }
+      rotate_tail(data() + index, data() + old_size, end());
+      return begin() + index;
+    }
+  }
+
+  template <typename... Args>
+  constexpr iterator emplace(const_iterator pos, Args &&...args) {
+    if constexpr (storage::kConstexpr) {
+      return insert_many(pos, make(std::forward<Args>(args)...));
+    } else {
+      if ((aliases(args) || ...)) {
+        return emplace(pos, T(std::forward<Args>(args)...));
+      }
+      return construct_gap(pos, 1, [&](T *slot, size_type &built) {
+        construct(slot, std::forward<Args>(args)...);
+        built = 1;
+      });
+    }
+  }
+
+  constexpr iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    size_type index = first - begin();
+    size_type count = last - first;
+    if (count) {
+      if constexpr (storage::kConstexpr) {
+        for (size_type i = index; i + count < size_; ++i) {
+          data()[i] = data()[i + count];
+        }
+      } else {
+        elements::destroy(data() + index, count);
+        elements::relocate(data() + index + count, size_ - index - count,
+                           data() + index);
+      }
+      size_ -= count;
+    }
+    return begin() + index;
+  }
+
+  constexpr void push_back(const T &value) { emplace_back(value); }
+
+  constexpr void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  constexpr reference emplace_back(Args &&...args) {
+    if (full()) throw std::length_error("static_vector is full");
+    construct(data() + size_, std::forward<Args>(args)...);
+    return data()[size_++];
+  }
+
+  constexpr void pop_back() {
+    if (size_ > 0) destroy_tail(size_ - 1);
+  }
+
+  constexpr void swap(static_vector &other) {
+    static_vector temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+
+  template <typename... Args>
+  constexpr iterator insert_many(const_iterator pos, Args &&...args) {
+    if constexpr (sizeof...(Args) == 0) {
+      return begin() + (pos - begin());
+    } else if constexpr (storage::kConstexpr) {
+      // args may be elements the gap moves
+      const T items[] = {make(std::forward<Args>(args))...};
+      iterator it = construct_gap(
+          pos, sizeof...(Args), [&](T *first, size_type &built) {
+            for (; built < sizeof...(Args); ++built) {
+              first[built] = items[built];
+            }
+          });
+      return it + sizeof...(Args);
+    } else {
+      if ((aliases(args) || ...)) {
+        return insert_many(pos, T(std::forward<Args>(args))...);
+      }
+      iterator it = construct_gap(
+          pos, sizeof...(Args), [&](T *first, size_type &built) {
+            ((construct(first + built, std::forward<Args>(args)), ++built),
+             ...);
+          });
+      return it + sizeof...(Args);
+    }
+  }
+
+  template <typename... Args>
+  constexpr void insert_many_back(Args &&...args) {
+    if (size_ + sizeof...(Args) > N) {
+      throw std::length_error("static_vector is full");
+    }
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  // T(args...), or T{args...} for aggregates
+  template <typename... Args>
+  static constexpr T make(Args &&...args) {
+    if constexpr (std::is_constructible<T, Args...>::value) {
+      return T(std::forward<Args>(args)...);
+    } else {
+      return T{std::forward<Args>(args)...};
+    }
+  }
+
+  // Makes *slot an element built from args: assigned for trivial T,
+  // constructed in the raw bytes otherwise
+  template <typename... Args>
+  constexpr void construct(T *slot, Args &&...args) {
+    if constexpr (storage::kConstexpr) {
+      *slot = make(std::forward<Args>(args)...);
+    } else {
+      new (slot) T(std::forward<Args>(args)...);
+    }
+  }
+
+  constexpr void destroy_tail(size_type new_size) noexcept {
+    if constexpr (!storage::kConstexpr) {
+      elements::destroy(data() + new_size, size_ - new_size);
+    }
+    size_ = new_size;
+  }
+
+  // Inserts count elements before pos, built in place by build(first,
+  // built), which constructs first[built] onwards and counts them in built.
+  // The tail moves once; if build throws, the elements it made are
+  // destroyed and the tail moves back.
+  template <typename Build>
+  constexpr iterator construct_gap(const_iterator pos, size_type count,
+                                   Build build) {
+    size_type index = pos - begin();
+    if (count > N - size_) throw std::length_error("static_vector is full");
+    if constexpr (storage::kConstexpr) {
+      for (size_type i = size_; i-- > index;) data()[i + count] = data()[i];
+      size_type built = 0;
+      build(data() + index, built);
+    } else {
+      build_in_gap(data() + index, size_ - index, count, build);
+    }
+    size_ += count;
+    return begin() + index;
+  }
+
+  // The run-time half of construct_gap (try is not allowed in a constexpr
+  // function before C++20)
+  template <typename Build>
+  static void build_in_gap(T *gap, size_type tail, size_type count,
+                           Build &build) {
+    size_type built = 0;
+    elements::relocate(gap, tail, gap + count);
+    try {
+      build(gap, built);
+    } catch (...) {
+      elements::destroy(gap, built);
+      elements::relocate(gap + count, tail, gap);
+      throw;
+    }
+  }
+
+  // Appends [first, last) at run time; if the range does not fit or
+  // anything throws, the appended elements are destroyed again
+  template <typename InputIt>
+  void append_or_undo(InputIt first, InputIt last) {
+    size_type old_size = size_;
+    try {
+      for (; first != last; ++first) emplace_back(*first);
+    } catch (...) {
+      destroy_tail(old_size);
+      throw;
+    }
+  }
+
+  constexpr iterator fill_gap(const_iterator pos, size_type count,
+                              const T &value) {
+    return construct_gap(pos, count, [&](T *first, size_type &built) {
+      for (; built < count; ++built) construct(first + built, value);
+    });
+  }
+
+  // std::rotate, which is not constexpr before C++20
+  static constexpr void rotate_tail(T *first, T *middle, T *last) {
+    if constexpr (storage::kConstexpr) {
+      for (T *next = middle; first != next;) {
+        T item = *first;
+        *first++ = *next;
+        *next++ = item;
+        if (next == last) {
+          next = middle;
+        } else if (first == middle) {
+          middle = next;
+        }
+      }
+    } else {
+      std::rotate(first, middle, last);
+    }
+  }
+
+  constexpr void take(static_vector &other) {
+    for (T &item : other) emplace_back(std::move(item));
+    other.clear();
+  }
+
+  // Whether value is one of the elements, which opening a gap would move.
+  // Trivial elements are never checked (comparing unrelated pointers is not
+  // a constant expression): emplace and the inserts copy them first.
+  template <typename U>
+  constexpr bool aliases(const U &value) const noexcept {
+    if constexpr (storage::kConstexpr) {
+      return false;
+    } else if constexpr (std::is_same<std::decay_t<U>, T>::value) {
+      return std::greater_equal<const T *>()(&value, data()) &&
+             std::less<const T *>()(&value, data() + size_);
+    } else {
+      return false;
+    }
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,279 @@
+#ifndef S21_TREE_BALANCE_H_
+#define S21_TREE_BALANCE_H_
+
+#include <cstddef>
+
+namespace s21 {
+// Balancing policies for BinaryTree. A policy keeps a node_data word in every
+// node and restores balance after the tree links in a new leaf
+// (after_insert) or unlinks a node (after_erase). It works through the
+// tree's rotations, which recompute update() and the NodeUpdate of both
+// rotated nodes, and must leave every node from the changed one up to the
+// root updated. The tree befriends its policy.
+//
+// after_erase(tree, child, parent, removed) gets the node that took the
+// removed position (possibly nullptr), its parent, and the node_data of the
+// removed position; with two children the successor takes over the data of
+// the erased node, as in CLRS.
+
+// AVL (the default): heights of the subtrees differ by at most one. The
+// lowest trees and fastest lookups, at the price of more rotations.
+struct avl_balance {
+  using node_data = unsigned char;  // height of the subtree
+  static constexpr node_data kNewNode = 1;
+  static constexpr bool kSubtreeSizes = false;
+
+  template <class Node>
+  static void update(Node *node) noexcept {
+    node_data left = height_of(node->left);
+    node_data right = height_of(node->right);
+    node->balance = (left > right ? left : right) + 1;
+  }
+
+  template <class Node>
+  static void on_build(Node *, std::size_t, std::size_t) noexcept {}
+
+  template <class Node>
+  static std::size_t height(const Node *root) noexcept {
+    return height_of(root);
+  }
+
+  template <class Tree, class Node>
+  static void after_insert(Tree &tree, Node *node) noexcept {
+    rebalance_up(tree, node->parent);
+  }
+
+  template <class Tree, class Node>
+  static void after_erase(Tree &tree, Node *, Node *parent,
+                          node_data) noexcept {
+    rebalance_up(tree, parent);
+  }
+
+ private:
+  template <class Node>
+  static node_data height_of(const Node *node) noexcept {
+    return node ? node->balance : 0;
+  }
+
+  template <class Node>
+  static int balance_factor(const Node *node) noexcept {
+    return height_of(node->right) - height_of(node->left);
+  }
+
+  // Stops at the first subtree that keeps its height, above which no height
+  // or balance factor changes and only the NodeUpdate has to reach the root;
+  // an append at the maximum usually stops within a node or two
+  template <class Tree, class Node>
+  static void rebalance_up(Tree &tree, Node *node) noexcept {
+    for (; node != tree.fake_; node = node->parent) {
+      node_data height = node->balance;
+      node = rebalance(tree, node);
+      if (node->balance == height) {
+        tree.update_path(node->parent);
+        return;
+      }
+    }
+  }
+
+  // Returns the root of the subtree after the rotations
+  template <class Tree, class Node>
+  static Node *rebalance(Tree &tree, Node *node) noexcept {
+    tree.update(node);
+    if (balance_factor(node) == 2) {
+      bool inner = balance_factor(node->right) < 0;
+      if (inner) tree.right_rotate(node->right);
+      tree.on_rotation(inner);
+      return tree.left_rotate(node);
+    }
+    if (balance_factor(node) == -2) {
+      bool inner = balance_factor(node->left) > 0;
+      if (inner) tree.left_rotate(node->left);
+      tree.on_rotation(inner);
+      return tree.right_rotate(node);
+    }
+    return node;
+  }
+};
+
+// Red-black: at most two rotations per insertion and three per erase, and
+// often none, at the price of trees up to twice as high as the optimum
+struct red_black_balance {
+  using node_data = unsigned char;  // color
+  static constexpr node_data kRed = 0;
+  static constexpr node_data kBlack = 1;
+  static constexpr node_data kNewNode = kRed;
+  static constexpr bool kSubtreeSizes = false;
+
+  template <class Node>
+  static void update(Node *) noexcept {}
+
+  // A perfectly balanced tree is valid when only its deepest level is red
+  template <class Node>
+  static void on_build(Node *node, std::size_t depth,
+                       std::size_t levels) noexcept {
+    node->balance = depth && depth + 1 == levels ? kRed : kBlack;
+  }
+
+  template <class Node>
+  static std::size_t height(const Node *root) noexcept {
+    if (!root) return 0;
+    std::size_t left = height(root->left), right = height(root->right);
+    return (left > right ? left : right) + 1;
+  }
+
+  template <class Tree, class Node>
+  static void after_insert(Tree &tree, Node *node) noexcept {
+    tree.update_path(node);
+    while (node->parent != tree.fake_ && is_red(node->parent)) {
+      Node *parent = node->parent;
+      Node *grand = parent->parent;
+      bool left_side = parent == grand->left;
+      Node *uncle = left_side ? grand->right : grand->left;
+      if (is_red(uncle)) {
+        parent->balance = uncle->balance = kBlack;
+        grand->balance = kRed;
+        node = grand;
+        continue;
+      }
+      bool inner = node == (left_side ? parent->right : parent->left);
+      if (inner) {
+        left_side ? tree.left_rotate(parent) : tree.right_rotate(parent);
+        parent = node;
+      }
+      left_side ? tree.right_rotate(grand) : tree.left_rotate(grand);
+      parent->balance = kBlack;
+      grand->balance = kRed;
+      tree.on_rotation(inner);
+      break;
+    }
+    tree.root_->balance = kBlack;
+  }
+
+  template <class Tree, class Node>
+  static void after_erase(Tree &tree, Node *node, Node *parent,
+                          node_data removed) noexcept {
+    tree.update_path(parent);
+    if (removed == kRed) return;
+    while (node != tree.root_ && !is_red(node)) {
+      bool left_side = node == parent->left;
+      Node *sibling = left_side ? parent->right : parent->left;
+      if (is_red(sibling)) {
+        sibling->balance = kBlack;
+        parent->balance = kRed;
+        left_side ? tree.left_rotate(parent) : tree.right_rotate(parent);
+        tree.on_rotation(false);
+        sibling = left_side ? parent->right : parent->left;
+      }
+      Node *near = left_side ? sibling->left : sibling->right;
+      Node *far = left_side ? sibling->right : sibling->left;
+      if (!is_red(near) && !is_red(far)) {
+        sibling->balance = kRed;
+        node = parent;
+        parent = node->parent;
+        continue;
+      }
+      bool inner = !is_red(far);
+      if (inner) {
+        near->balance = kBlack;
+        sibling->balance = kRed;
+        left_side ? tree.right_rotate(sibling) : tree.left_rotate(sibling);
+        sibling = near;
+        far = left_side ? sibling->right : sibling->left;
+      }
+      sibling->balance = parent->balance;
+      parent->balance = kBlack;
+      far->balance = kBlack;
+      left_side ? tree.left_rotate(parent) : tree.right_rotate(parent);
+      tree.on_rotation(inner);
+      node = tree.root_;
+    }
+    if (node) node->balance = kBlack;
+  }
+
+ private:
+  template <class Node>
+  static bool is_red(const Node *node) noexcept {
+    return node && node->balance == kRed;
+  }
+};
+
+// Weight-balanced (BB[alpha] with the <3, 2> parameters of Hirai and
+// Yamamoto): no subtree is more than three times as heavy as its sibling.
+// Every node knows the size of its subtree, which gives the tree rank and
+// select in O(log n).
+struct weight_balance {
+  using node_data = std::size_t;  // nodes in the subtree
+  static constexpr node_data kNewNode = 1;
+  static constexpr bool kSubtreeSizes = true;
+
+  template <class Node>
+  static std::size_t subtree_size(const Node *node) noexcept {
+    return node ? node->balance : 0;
+  }
+
+  template <class Node>
+  static void update(Node *node) noexcept {
+    node->balance = subtree_size(node->left) + subtree_size(node->right) + 1;
+  }
+
+  template <class Node>
+  static void on_build(Node *, std::size_t, std::size_t) noexcept {}
+
+  template <class Node>
+  static std::size_t height(const Node *root) noexcept {
+    if (!root) return 0;
+    std::size_t left = height(root->left), right = height(root->right);
+    return (left > right ? left : right) + 1;
+  }
+
+  template <class Tree, class Node>
+  static void after_insert(Tree &tree, Node *node) noexcept {
+    rebalance_up(tree, node->parent);
+  }
+
+  template <class Tree, class Node>
+  static void after_erase(Tree &tree, Node *, Node *parent,
+                          node_data) noexcept {
+    rebalance_up(tree, parent);
+  }
+
+ private:
+  static constexpr std::size_t kDelta = 3;
+  static constexpr std::size_t kGamma = 2;
+
+  template <class Node>
+  static std::size_t weight(const Node *node) noexcept {
+    return subtree_size(node) + 1;
+  }
+
+  template <class Tree, class Node>
+  static void rebalance_up(Tree &tree, Node *node) noexcept {
+    for (; node != tree.fake_; node = node->parent) {
+      node = rebalance(tree, node);
+    }
+  }
+
+  template <class Tree, class Node>
+  static Node *rebalance(Tree &tree, Node *node) noexcept {
+    tree.update(node);
+    std::size_t left = weight(node->left), right = weight(node->right);
+    if (right > kDelta * left) {
+      Node *heavy = node->right;
+      bool inner = weight(heavy->left) >= kGamma * weight(heavy->right);
+      if (inner) tree.right_rotate(heavy);
+      tree.on_rotation(inner);
+      return tree.left_rotate(node);
+    }
+    if (left > kDelta * right) {
+      Node *heavy = node->left;
+      bool inner = weight(heavy->right) >= kGamma * weight(heavy->left);
+      if (inner) tree.left_rotate(heavy);
+      tree.on_rotation(inner);
+      return tree.right_rotate(node);
+    }
+    return node;
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef S21_TREE_STATS_H_
+#define S21_TREE_STATS_H_
+
+#include <cstddef>
+
+namespace s21 {
+// Statistics policies for BinaryTree. The tree reports every key comparison,
+// rebalancing rotation, node allocation and free, and the depth at which
+// each lookup or insertion stopped. Frees of a whole tree arrive as one
+// on_free(count). The hooks are const so lookups can be counted too; a
+// policy keeps its counters mutable.
+
+// Default policy: empty hooks that compile away, and no storage thanks to
+// the empty base optimization
+struct tree_stats_disabled {
+  void on_compare() const noexcept {}
+  void on_rotation(bool) const noexcept {}
+  void on_allocate() const noexcept {}
+  void on_free() const noexcept {}
+  void on_free(std::size_t) const noexcept {}
+  void on_descent(std::size_t) const noexcept {}
+};
+
+struct tree_stats {
+  mutable std::size_t comparisons = 0;
+  mutable std::size_t single_rotations = 0;
+  mutable std::size_t double_rotations = 0;
+  mutable std::size_t allocations = 0;
+  mutable std::size_t frees = 0;
+  mutable std::size_t descents = 0;
+  mutable std::size_t total_depth = 0;
+  mutable std::size_t max_depth = 0;
+
+  void on_compare() const noexcept { ++comparisons; }
+
+  void on_rotation(bool double_rotation) const noexcept {
+    ++(double_rotation ? double_rotations : single_rotations);
+  }
+
+  void on_allocate() const noexcept { ++allocations; }
+
+  void on_free() const noexcept { ++frees; }
+
+  void on_free(std::size_t count) const noexcept { frees += count; }
+
+  void on_descent(std::size_t depth) const noexcept {
+    ++descents;
+    total_depth += depth;
+    if (depth > max_depth) max_depth = depth;
+  }
+
+  double average_depth() const noexcept {
+    return descents ? static_cast<double>(total_depth) / descents : 0.0;
+  }
+
+  void reset() const noexcept {
+    comparisons = single_rotations = double_rotations = 0;
+    allocations = frees = descents = total_depth = max_depth = 0;
+  }
+};
+}  // namespace s21
+
+#endif
@@ -1,12 +1,148 @@
 #ifndef S21_VECTOR_H_
 #define S21_VECTOR_H_
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "s21_memory.h"
+#include "s21_vector_growth.h"
 
 namespace s21 {
 
+// Types whose objects can be moved to another address by copying their
+// bytes and forgetting the original, without running the move constructor
+// and destructor. True for trivially copyable types; specialize it as
+// std::true_type for types that merely own resources through pointers
+// (no pointers into themselves), e.g. a handle wrapping a std::unique_ptr.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Element storage shared by s21::vector and s21::small_vector: raw buffers
+// and bulk construction, relocation and destruction of elements in them.
 template <typename T>
-class vector {
+struct vector_elements_ {
+  using size_type = std::size_t;
+
+  // Trivially relocatable elements live in malloc memory and grow with
+  // realloc, which extends the block in place when the memory after it is
+  // free; glibc serves large blocks with mmap and grows them with mremap,
+  // so even a moved buffer is remapped rather than copied
+  static constexpr bool kReallocates =
+      is_trivially_relocatable<T>::value &&
+      alignof(T) <= alignof(std::max_align_t);
+
+  static T *allocate(size_type n) {
+    if constexpr (kReallocates) {
+      void *memory = std::malloc(n * sizeof(T));
+      if (!memory) throw std::bad_alloc();
+      return static_cast<T *>(memory);
+    } else {
+      return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+  }
+
+  static void deallocate(T *data) noexcept {
+    if constexpr (kReallocates) {
+      std::free(data);
+    } else {
+      ::operator delete(data);
+    }
+  }
+
+  // Moves n elements from `from` to uninitialized `to` and ends the lifetime
+  // of the originals; the ranges may overlap. Trivially relocatable types
+  // move as one memmove.
+  static void relocate(T *from, size_type n, T *to) {
+    if constexpr (is_trivially_relocatable<T>::value) {
+      if (n) std::memmove(static_cast<void *>(to), from, n * sizeof(T));
+    } else if (to < from) {
+      for (size_type i = 0; i < n; ++i) {
+        new (&to[i]) T(std::move(from[i]));
+        from[i].~T();
+      }
+    } else {
+      for (size_type i = n; i-- > 0;) {
+        new (&to[i]) T(std::move(from[i]));
+        from[i].~T();
+      }
+    }
+  }
+
+  // Copy-constructs n elements into uninitialized `to`; on an exception the
+  // copies made so far are destroyed
+  static void copy_construct(const T *from, size_type n, T *to) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+      if (n) std::memcpy(static_cast<void *>(to), from, n * sizeof(T));
+    } else {
+      size_type i = 0;
+      try {
+        for (; i < n; ++i) new (&to[i]) T(from[i]);
+      } catch (...) {
+        destroy(to, i);
+        throw;
+      }
+    }
+  }
+
+  static void destroy(T *first, size_type n) noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+      for (size_type i = 0; i < n; ++i) first[i].~T();
+    }
+  }
+};
+
+// Whether Allocator constructs or destroys T itself (scoped and
+// polymorphic allocators do); vector then routes every element through
+// std::allocator_traits instead of building and moving elements in bulk
+template <class Allocator, class T, class = void>
+struct allocator_constructs_ : std::false_type {};
+
+template <class Allocator, class T>
+struct allocator_constructs_<
+    Allocator, T,
+    std::void_t<decltype(std::declval<Allocator &>().construct(
+        std::declval<T *>(), std::declval<T &&>()))>> : std::true_type {};
+
+template <class Allocator, class T, class = void>
+struct allocator_destroys_ : std::false_type {};
+
+template <class Allocator, class T>
+struct allocator_destroys_<
+    Allocator, T,
+    std::void_t<decltype(std::declval<Allocator &>().destroy(
+        std::declval<T *>()))>> : std::true_type {};
+
+// Keeps a vector's allocator as a base, so a stateless one takes no space
+template <class Allocator>
+struct vector_allocator_ : Allocator {
+  explicit vector_allocator_(const Allocator &alloc) noexcept
+      : Allocator(alloc) {}
+
+  explicit vector_allocator_(Allocator &&alloc) noexcept
+      : Allocator(std::move(alloc)) {}
+};
+
+// Tag for the constructor that default-initializes its n elements
+struct default_init_t {
+  explicit default_init_t() = default;
+};
+inline constexpr default_init_t default_init{};
+
+// Memory comes from Allocator through std::allocator_traits, honouring its
+// propagation traits; use s21::aligned_allocator for over-aligned buffers.
+// With the default std::allocator, trivially relocatable elements grow with
+// realloc instead. Growth decides how far push_back and inserts grow a full
+// buffer; see s21_vector_growth.h
+template <typename T, class Allocator = std::allocator<T>,
+          class Growth = doubling_growth>
+class vector : private vector_elements_<T>,
+               private vector_allocator_<Allocator> {
   using size_type = std::size_t;
   using value_type = T;
   using reference = T &;
@@ -14,86 +150,322 @@ class vector {
   using iterator = T *;
   using const_iterator = const T *;
 
+ public:
+  using allocator_type = Allocator;
+
  private:
   T *data_;             // Pointer to the dynamic array
   size_type size_;      // Number of elements currently in the vector
   size_type capacity_;  // Allocated capacity
 
+  using elements = vector_elements_<T>;
+  using holder = vector_allocator_<Allocator>;
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                "vector: Allocator::value_type must be T");
+
+  // std::allocator's construct (deprecated in C++17) is placement new
+  static constexpr bool kTraitsConstruct =
+      !std::is_same<Allocator, std::allocator<T>>::value &&
+      (allocator_constructs_<Allocator, T>::value ||
+       allocator_destroys_<Allocator, T>::value);
+  static constexpr bool kReallocates =
+      elements::kReallocates && !kTraitsConstruct &&
+      std::is_same<Allocator, std::allocator<T>>::value;
+
+  Allocator &allocator() noexcept { return static_cast<holder &>(*this); }
+
+  const Allocator &allocator() const noexcept {
+    return static_cast<const holder &>(*this);
+  }
+
+  T *allocate(size_type n) {
+    if constexpr (kReallocates) {
+      return elements::allocate(n);
+    } else {
+      return alloc_traits::allocate(allocator(), n);
+    }
+  }
+
+  void deallocate(T *data, size_type n) noexcept {
+    if constexpr (kReallocates) {
+      elements::deallocate(data);
+    } else if (data) {
+      alloc_traits::deallocate(allocator(), data, n);
+    }
+  }
+
+  template <typename... Args>
+  void construct(T *slot, Args &&...args) {
+    if constexpr (kTraitsConstruct) {
+      alloc_traits::construct(allocator(), slot, std::forward<Args>(args)...);
+    } else {
+      new (slot) T(std::forward<Args>(args)...);
+    }
+  }
+
+  // Default-initializes *slot; an allocator that constructs can only
+  // value-initialize
+  void default_construct(T *slot) {
+    if constexpr (kTraitsConstruct) {
+      alloc_traits::construct(allocator(), slot);
+    } else {
+      new (slot) T;
+    }
+  }
+
+  void destroy(T *first, size_type n) noexcept {
+    if constexpr (kTraitsConstruct) {
+      for (size_type i = 0; i < n; ++i) {
+        alloc_traits::destroy(allocator(), first + i);
+      }
+    } else {
+      elements::destroy(first, n);
+    }
+  }
+
+  // As vector_elements_::relocate, through the allocator if it constructs
+  void relocate(T *from, size_type n, T *to) {
+    if constexpr (kTraitsConstruct) {
+      bool forward = to < from;
+      for (size_type k = 0; k < n; ++k) {
+        size_type i = forward ? k : n - 1 - k;
+        construct(to + i, std::move(from[i]));
+        alloc_traits::destroy(allocator(), from + i);
+      }
+    } else {
+      elements::relocate(from, n, to);
+    }
+  }
+
+  void copy_construct(const T *from, size_type n, T *to) {
+    if constexpr (kTraitsConstruct) {
+      size_type i = 0;
+      try {
+        for (; i < n; ++i) construct(to + i, from[i]);
+      } catch (...) {
+        destroy(to, i);
+        throw;
+      }
+    } else {
+      elements::copy_construct(from, n, to);
+    }
+  }
+
+  // Moves the elements to a buffer of new_capacity elements
+  void reallocate(size_type new_capacity) {
+    if constexpr (kReallocates) {
+      if (new_capacity == 0) {
+        std::free(data_);
+        data_ = nullptr;
+      } else {
+        void *memory = std::realloc(static_cast<void *>(data_),
+                                    new_capacity * sizeof(T));
+        if (!memory) throw std::bad_alloc();
+        data_ = static_cast<T *>(memory);
+      }
+    } else {
+      T *new_data = new_capacity ? allocate(new_capacity) : nullptr;
+      relocate(data_, size_, new_data);
+      deallocate(data_, capacity_);
+      data_ = new_data;
+    }
+    capacity_ = new_capacity;
+  }
+
+  // Destroys the elements and frees the buffer
+  void release() noexcept {
+    clear();
+    deallocate(data_, capacity_);
+    data_ = nullptr;
+    capacity_ = 0;
+  }
+
+  // Exchanges the buffers, not the allocators
+  void swap_buffers(vector &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+  // Capacity to grow to when at least `required` elements must fit
+  size_type grown_capacity(size_type required) {
+    if (required > max_size()) {
+      throw std::length_error("new capacity greater than maximum capacity");
+    }
+    size_type proposed = Growth::next_capacity(capacity_, required, sizeof(T));
+    return std::min(std::max(required, proposed), max_size());
+  }
+
+  // Whether value is one of the elements, which opening a gap would move
+  template <typename U>
+  bool aliases(const U &value) const noexcept {
+    if constexpr (std::is_same<std::decay_t<U>, T>::value) {
+      return std::greater_equal<const T *>()(&value, data_) &&
+             std::less<const T *>()(&value, data_ + size_);
+    } else {
+      return false;
+    }
+  }
+
+  // Inserts count elements before index, constructed in place by
+  // build(first, built), which constructs first[built] onwards and counts
+  // them in built. The tail moves exactly once: straight into the new
+  // buffer when capacity runs out (after a realloc for reallocating types),
+  // otherwise count slots along. If build throws, the elements it made are
+  // destroyed and the elements are restored.
+  template <typename Build>
+  iterator construct_gap(size_type index, size_type count, Build build) {
+    if (count == 0) return data_ + index;
+    size_type built = 0;
+    if (kReallocates && size_ + count > capacity_) {
+      reallocate(grown_capacity(size_ + count));
+    }
+    if (size_ + count > capacity_) {
+      size_type new_capacity = grown_capacity(size_ + count);
+      T *new_data = allocate(new_capacity);
+      try {
+        build(new_data + index, built);  // old elements are still in place
+      } catch (...) {
+        destroy(new_data + index, built);
+        deallocate(new_data, new_capacity);
+        throw;
+      }
+      relocate(data_, index, new_data);
+      relocate(data_ + index, size_ - index, new_data + index + count);
+      deallocate(data_, capacity_);
+      data_ = new_data;
+      capacity_ = new_capacity;
+    } else {
+      relocate(data_ + index, size_ - index, data_ + index + count);
+      try {
+        build(data_ + index, built);
+      } catch (...) {
+        destroy(data_ + index, built);
+        relocate(data_ + index + count, size_ - index, data_ + index);
+        throw;
+      }
+    }
+    size_ += count;
+    return data_ + index;
+  }
+
  public:
   // Constructors, destructor, and assignment operators will be declared here
 
   // Default constructor
-  vector() : data_(nullptr), size_(0), capacity_(0) {}
+  vector() noexcept(noexcept(Allocator())) : vector(Allocator()) {}
+
+  // Empty vector drawing memory from alloc
+  explicit vector(const Allocator &alloc) noexcept
+      : holder(alloc), data_(nullptr), size_(0), capacity_(0) {}
 
   // Parameterized constructor, creates the vector of size n
-  vector(size_type n) : vector() { resize(n); }
+  vector(size_type n, const Allocator &alloc = Allocator()) : vector(alloc) {
+    resize(n);
+  }
+
+  // Creates n default-initialized elements: trivial ones are left
+  // unwritten, for a buffer that read() or a decoder fills next
+  vector(size_type n, default_init_t, const Allocator &alloc = Allocator())
+      : vector(alloc) {
+    resize_default_init(n);
+  }
 
   // Initializer list constructor, creates a vector initizialized using
   // std::initializer_list
-  vector(std::initializer_list<value_type> const &items) : vector() {
-    for (const auto &item : items) {
-      push_back(item);
-    }
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator())
+      : vector(alloc) {
+    insert(end(), items.begin(), items.end());
   }
 
-  // Copy Constructor
+  // Copy Constructor; the allocator is the one
+  // select_on_container_copy_construction gives
   vector(const vector &other)
-      : data_(nullptr), size_(other.size_), capacity_(other.size_) {
-    if (capacity_ > 0) {
-      data_ = static_cast<T *>(::operator new(capacity_ * sizeof(T)));
-      for (size_t i = 0; i < size_; ++i) {
-        new (&data_[i]) T(other.data_[i]);  // Copy construct each element
-      }
-    }
+      : vector(other, alloc_traits::select_on_container_copy_construction(
+                          other.allocator())) {}
+
+  vector(const vector &other, const Allocator &alloc) : vector(alloc) {
+    reserve(other.size_);
+    copy_construct(other.data_, other.size_, data_);
+    size_ = other.size_;
   }
 
   // Move Constructor
   vector(vector &&other) noexcept
-      : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+      : holder(std::move(other.allocator())),
+        data_(other.data_),
+        size_(other.size_),
+        capacity_(other.capacity_) {
     other.data_ = nullptr;
     other.size_ = 0;
     other.capacity_ = 0;
   }
 
-  // Destructor
-  ~vector() {
-    clear();                   // Destroy all elements
-    ::operator delete(data_);  // Deallocate memory
+  // Takes the buffer of other if alloc can free it, otherwise moves the
+  // elements one by one
+  vector(vector &&other, const Allocator &alloc) : vector(alloc) {
+    if (alloc_traits::is_always_equal::value || alloc == other.allocator()) {
+      swap_buffers(other);
+    } else {
+      insert(end(), std::make_move_iterator(other.begin()),
+             std::make_move_iterator(other.end()));
+      other.clear();
+    }
   }
 
+  // Destructor
+  ~vector() { release(); }
+
   // Copy Assignment Operator
-  vector<T> &operator=(const vector &other) {
+  vector &operator=(const vector &other) {
     if (this != &other) {
-      vector temp(other);  // Copy constructor
-      swap(temp);          // Swap with temporary
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (allocator() != other.allocator()) release();
+        allocator() = other.allocator();
+      }
+      vector temp(other, allocator());  // Copy constructor
+      swap_buffers(temp);               // Swap with temporary
     }
     return *this;
   }
 
-  // Move Assignment Operator
-  vector<T> &operator=(vector &&other) noexcept {
+  // Move Assignment Operator; moves the elements one by one only when the
+  // allocators differ and do not propagate
+  vector &operator=(vector &&other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
     if (this != &other) {
-      clear();  // Destroy current elements
-
-      ::operator delete(data_);  // Deallocate current memory
-
-      data_ = other.data_;
-      size_ = other.size_;
-      capacity_ = other.capacity_;
-
-      other.data_ = nullptr;
-      other.size_ = 0;
-      other.capacity_ = 0;
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                        value) {
+        release();
+        allocator() = std::move(other.allocator());
+        swap_buffers(other);
+      } else if (alloc_traits::is_always_equal::value ||
+                 allocator() == other.allocator()) {
+        release();
+        swap_buffers(other);
+      } else {
+        vector temp(std::move(other), allocator());
+        swap_buffers(temp);
+      }
     }
     return *this;
   }
 
+  allocator_type get_allocator() const { return allocator(); }
+
   // Access a specified element
   reference operator[](size_t index) {
     // Optionally add bounds checking in debug mode
     return data_[index];
   }
 
+  const_reference operator[](size_t index) const { return data_[index]; }
+
   // Access a specified element with bounds checking
   reference at(size_type index) {
     if (index >= size_) {
@@ -111,21 +483,29 @@ class vector {
   // direct access the underlying array
   T *data() { return data_; }
 
+  const T *data() const { return data_; }
+
   // returns an iterator to the beginning
   iterator begin() { return &data_[0]; }
 
   // returns an iterator to the end
   iterator end() { return &data_[size_]; }
 
+  const_iterator begin() const { return data_; }
+
+  const_iterator end() const { return data_ + size_; }
+
   // checks whether the container is empty
-  bool empty() { return !(bool)size_; }
+  bool empty() const { return !(bool)size_; }
 
   // Returns the number of elements in container
   size_t size() const { return size_; }
 
   // returns the maximum possible number of elements
-  size_type max_size() {
-    return (std::numeric_limits<size_type>::max() / sizeof(value_type)) / 2;
+  size_type max_size() const {
+    return std::min<size_type>(
+        alloc_traits::max_size(allocator()),
+        (std::numeric_limits<size_type>::max() / sizeof(value_type)) / 2);
   }
 
   // Allocate storage of size elements and copies current array elements to a
@@ -137,132 +517,211 @@ class vector {
       throw std::length_error("new capacity greater than maximum capacity");
     }
 
-    T *new_data = static_cast<T *>(::operator new(new_capacity * sizeof(T)));
-    for (size_t i = 0; i < size_; ++i) {
-      new (&new_data[i])
-          T(std::move(data_[i]));  // Move construct into new array
-      data_[i].~T();               // Destroy old object
-    }
-    ::operator delete(data_);  // Deallocate old memory
-    data_ = new_data;
-    capacity_ = new_capacity;
+    reallocate(new_capacity);
   }
 
   // Returns the number of elements that can be held in currently
   // allocated storage
   size_t capacity() const { return capacity_; }
 
+  // Reports the heap buffer: used slots as payload, spare capacity as
+  // overhead
+  memory_report memory_usage() const {
+    memory_report report;
+    report.payload_bytes = size_ * sizeof(T);
+    report.overhead_bytes = (capacity_ - size_) * sizeof(T);
+    report.allocations = data_ ? 1 : 0;
+    return report;
+  }
+
   // Resizes the container
   void resize(size_t new_size) {
     if (new_size < size_) {
-      for (size_t i = new_size; i < size_; ++i) {
-        data_[i].~T();  // Destroy surplus elements
-      }
+      destroy(data_ + new_size, size_ - new_size);  // Destroy surplus elements
     } else if (new_size > size_) {
       if (new_size > capacity_) {
         reserve(new_size);  // Reserve enough capacity
       }
       for (size_t i = size_; i < new_size; ++i) {
-        new (&data_[i]) T();  // Default-construct new elements
+        construct(data_ + i);  // Default-construct new elements
       }
     }
     size_ = new_size;
   }
 
-  // Reduces memory usage by freeing unused memory
-  void shrink_to_fit() {
-    size_t new_capacity = size_;
+  // As resize, but new elements are default-initialized rather than
+  // value-initialized, so trivially default-constructible ones keep whatever
+  // bytes the buffer held instead of being zeroed
+  void resize_default_init(size_type new_size) {
+    if (new_size <= size_) return resize(new_size);
+    reserve(new_size);
+    if constexpr (std::is_trivially_default_constructible<T>::value) {
+      size_ = new_size;
+    } else {
+      for (; size_ < new_size; ++size_) default_construct(data_ + size_);
+    }
+  }
 
-    T *new_data = static_cast<T *>(::operator new(new_capacity * sizeof(T)));
-    for (size_t i = 0; i < size_; ++i) {
-      new (&new_data[i])
-          T(std::move(data_[i]));  // Move construct into new array
-      data_[i].~T();               // Destroy old object
+  // resize_default_init for trivial T only, where it guarantees that the new
+  // elements are not written at all; their values are indeterminate until
+  // the caller stores to them
+  void resize_uninitialized(size_type new_size) {
+    static_assert(std::is_trivially_default_constructible<T>::value &&
+                      std::is_trivially_destructible<T>::value,
+                  "vector: resize_uninitialized needs a trivial T, use "
+                  "resize_default_init");
+    resize_default_init(new_size);
+  }
+
+  // Appends n unwritten elements of a trivial T and returns a pointer to the
+  // first, for a syscall or decoder to fill in place; resize() back down if
+  // fewer were filled. The buffer grows by Growth, so repeated appends stay
+  // amortized O(1) per element.
+  T *append_uninitialized(size_type n) {
+    static_assert(std::is_trivially_default_constructible<T>::value &&
+                      std::is_trivially_destructible<T>::value,
+                  "vector: append_uninitialized needs a trivial T");
+    if (n > max_size() - size_) {
+      throw std::length_error("new capacity greater than maximum capacity");
     }
-    ::operator delete(data_);  // Deallocate old memory
-    data_ = new_data;
-    capacity_ = new_capacity;
+    if (size_ + n > capacity_) reallocate(grown_capacity(size_ + n));
+    T *first = data_ + size_;
+    size_ += n;
+    return first;
+  }
+
+  // Reduces memory usage by freeing unused memory
+  void shrink_to_fit() {
+    if (size_ < capacity_) reallocate(size_);
   }
 
   // Clear container elements
   void clear() {
-    for (size_t i = 0; i < size_; ++i) {
-      data_[i].~T();  // Manually call destructor
-    }
+    destroy(data_, size_);
     size_ = 0;
   }
 
   // inserts elements into concrete pos and returns the iterator that points
   // to the new element iterator
   iterator insert(const_iterator pos, const_reference value) {
-    size_type index = pos - begin();
-    resize(size_ + 1);
-    for (size_type i = size_ - 1; i > index; --i) {
-      new (&data_[i]) T(std::move(data_[i - 1]));
-    }
-    new (&data_[index]) T(value);
-    return begin() + index;
+    return emplace(pos, value);
   }
 
-  // erases an element at position
-  void erase(const_iterator pos) {
+  iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  // Inserts count copies of value before pos
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    if (aliases(value)) return insert(pos, count, T(value));
+    return construct_gap(pos - begin(), count, [&](T *first, size_type &built) {
+      for (; built < count; ++built) construct(first + built, value);
+    });
+  }
+
+  // Inserts copies of [first, last) before pos; the range must not be part
+  // of this vector. Forward ranges move the tail once, single-pass input
+  // ranges are appended and rotated into place.
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
     size_type index = pos - begin();
-    data_[index].~T();
-    for (size_type i = index; i < size_ - 1; ++i) {
-      new (&data_[i]) T(std::move(data_[i + 1]));
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  category>::value) {
+      size_type count = std::distance(first, last);
+      return construct_gap(index, count, [&](T *slots, size_type &built) {
+        for (; built < count; ++built, ++first) {
+          construct(slots + built, *first);
+        }
+      });
+    } else {
+      size_type old_size = size_;
+      for (; first != last; ++first) emplace_back(*first);
+      std::rotate(begin() + index, begin() + old_size, end());
+      return begin() + index;
     }
-    --size_;
   }
 
-  // Copy adds an element to the end
-  void push_back(const T &value) {
-    if (size_ == capacity_) {
-      reserve(capacity_ == 0 ? 1 : capacity_ * 2);  // Double capacity
+  // Constructs an element from args directly before pos
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if ((aliases(args) || ...)) {
+      return emplace(pos, T(std::forward<Args>(args)...));
     }
-    new (&data_[size_]) T(value);  // Copy-construct new element
-    ++size_;
+    return construct_gap(pos - begin(), 1, [&](T *slot, size_type &built) {
+      construct(slot, std::forward<Args>(args)...);
+      built = 1;
+    });
   }
 
-  // Move adds an element to the end
-  void push_back(T &&value) {
-    if (size_ == capacity_) {
-      reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+  // erases an element at position
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  // Erases [first, last), moving the tail once; returns the iterator
+  // following the erased elements
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = first - begin();
+    size_type count = last - first;
+    if (count) {
+      destroy(data_ + index, count);
+      relocate(data_ + index + count, size_ - index - count, data_ + index);
+      size_ -= count;
     }
-    new (&data_[size_]) T(std::move(value));  // Move-construct new element
-    ++size_;
+    return begin() + index;
   }
 
+  // Copy adds an element to the end
+  void push_back(const T &value) { emplace_back(value); }
+
+  // Move adds an element to the end
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  // Constructs an element at the end; a full buffer grows by Growth, and an
+  // argument that is an element of the vector is copied first
   template <typename... Args>
   void emplace_back(Args &&...args) {
     if (size_ == capacity_) {
-      reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+      if ((aliases(args) || ...)) {
+        return emplace_back(T(std::forward<Args>(args)...));
+      }
+      reallocate(grown_capacity(size_ + 1));
     }
-    new (&data_[size_])
-        T(std::forward<Args>(args)...);  // Perfect-forward arguments
+    construct(data_ + size_, std::forward<Args>(args)...);  // Perfect-forward
     ++size_;
   }
 
   // Removes the last element
   void pop_back() {
     if (size_ > 0) {
-      data_[size_ - 1].~T();
+      destroy(data_ + size_ - 1, 1);
       --size_;
     }
   }
 
-  // Swap Function (Helper)
+  // Swap Function (Helper); the allocators are swapped only if they
+  // propagate on swap, otherwise they must compare equal
   void swap(vector &other) noexcept {
-    std::swap(data_, other.data_);
-    std::swap(size_, other.size_);
-    std::swap(capacity_, other.capacity_);
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(allocator(), other.allocator());
+    }
+    swap_buffers(other);
   }
 
-  // Inserts new elements into the container directly before pos
+  // Inserts new elements into the container directly before pos, moving the
+  // tail once; returns the iterator following the last of them
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
-    iterator it = iterator(pos);
-    ((it = insert(it, std::forward<Args>(args)) + 1), ...);
-    return it;
+    if ((aliases(args) || ...)) {
+      return insert_many(pos, T(std::forward<Args>(args))...);
+    }
+    iterator it = construct_gap(
+        pos - begin(), sizeof...(Args),
+        [&]([[maybe_unused]] T *first, [[maybe_unused]] size_type &built) {
+          ((construct(first + built, std::forward<Args>(args)), ++built), ...);
+        });
+    return it + sizeof...(Args);
   }
 
   template <typename... Args>
@@ -0,0 +1,58 @@
+#ifndef S21_VECTOR_GROWTH_H_
+#define S21_VECTOR_GROWTH_H_
+
+#include <cstddef>
+
+namespace s21 {
+// Growth policies for s21::vector. When `required` elements no longer fit,
+// next_capacity(capacity, required, element_size) proposes the capacity to
+// grow to. The vector raises the proposal to at least `required` and
+// clamps it to max_size().
+
+// Doubling (the default): the fewest reallocations, at the price of up to
+// twice the memory the elements need.
+struct doubling_growth {
+  static constexpr std::size_t next_capacity(std::size_t capacity,
+                                             std::size_t,
+                                             std::size_t) noexcept {
+    return capacity ? capacity * 2 : 1;
+  }
+};
+
+// 1.5x: at most half the buffer is slack, and after a few steps the blocks
+// freed earlier add up to the next request, so the allocator can reuse them.
+struct one_and_half_growth {
+  static constexpr std::size_t next_capacity(std::size_t capacity,
+                                             std::size_t,
+                                             std::size_t) noexcept {
+    return capacity + capacity / 2;
+  }
+};
+
+// 1.5x rounded up to the allocator's size classes: 16-byte steps up to
+// 128 bytes, four classes per power of two up to a page (as in jemalloc and
+// tcmalloc), then whole pages. The allocator hands out these rounded blocks
+// anyway, so the rounding becomes usable capacity instead of hidden slack.
+struct size_class_growth {
+  static constexpr std::size_t kPage = 4096;
+
+  static constexpr std::size_t next_capacity(
+      std::size_t capacity, std::size_t required,
+      std::size_t element_size) noexcept {
+    std::size_t wanted = capacity + capacity / 2;
+    if (wanted < required) wanted = required;
+    return size_class(wanted * element_size) / element_size;
+  }
+
+  static constexpr std::size_t size_class(std::size_t bytes) noexcept {
+    if (bytes <= 128) return (bytes + 15) & ~std::size_t(15);
+    if (bytes > kPage) return (bytes + kPage - 1) & ~(kPage - 1);
+    std::size_t step = 128;
+    while (step * 2 < bytes) step *= 2;
+    step /= 4;
+    return (bytes + step - 1) / step * step;
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,112 @@
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "s21_tests.h"
+
+namespace {
+struct concat_monoid {
+  std::string identity() const { return std::string(); }
+  std::string operator()(const std::string &lhs,
+                         const std::string &rhs) const {
+    return lhs + rhs;
+  }
+};
+}  // namespace
+
+TEST(AggregateMap, SumOverRanges) {
+  s21::aggregate_map<int, std::int64_t> map{{1, 10}, {3, 30}, {5, 50}, {7, 70}};
+
+  EXPECT_EQ(map.aggregate(), 160);
+  EXPECT_EQ(map.aggregate(3, 7), 80);
+  EXPECT_EQ(map.aggregate(0, 100), 160);
+  EXPECT_EQ(map.aggregate(2, 3), 0);
+  EXPECT_EQ(map.aggregate(6, 6), 0);
+  EXPECT_EQ(map.aggregate(7, 1), 0);
+}
+
+TEST(AggregateMap, AssignAndAccumulate) {
+  s21::aggregate_map<int, std::int64_t> map;
+  map.accumulate(4, 5);
+  map.accumulate(4, 7);
+  map.accumulate(2, 1);
+  EXPECT_EQ(map.at(4), 12);
+  EXPECT_EQ(map.aggregate(), 13);
+
+  EXPECT_FALSE(map.insert(2, 100).second);
+  EXPECT_EQ(map.aggregate(), 13);
+  map.insert_or_assign(2, 100);
+  EXPECT_EQ(map.aggregate(0, 3), 100);
+  EXPECT_THROW(map.at(3), std::out_of_range);
+
+  map.erase(map.find(4));
+  EXPECT_EQ(map.aggregate(), 100);
+  EXPECT_EQ(map.erase(2), 1);
+  EXPECT_EQ(map.aggregate(), 0);
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(AggregateMap, MinMax) {
+  s21::aggregate_map<int, int, s21::min_monoid<int>> low{
+      {1, 4}, {2, -3}, {3, 8}, {4, 0}};
+  s21::aggregate_map<int, int, s21::max_monoid<int>> high{
+      {1, 4}, {2, -3}, {3, 8}, {4, 0}};
+
+  EXPECT_EQ(low.aggregate(), -3);
+  EXPECT_EQ(low.aggregate(3, 5), 0);
+  EXPECT_EQ(high.aggregate(1, 3), 4);
+  EXPECT_EQ(high.aggregate(), 8);
+  EXPECT_EQ(high.aggregate(5, 9), std::numeric_limits<int>::lowest());
+}
+
+TEST(AggregateMap, KeepsKeyOrderForNonCommutativeMonoid) {
+  s21::aggregate_map<int, std::string, concat_monoid> map;
+  const std::string letters = "abcdefghijklmnopqrstuvwxyz";
+  for (int i : {13, 2, 25, 7, 0, 19, 4, 11, 22, 16, 1, 9, 5, 3, 24, 8, 6, 10,
+                12, 14, 15, 17, 18, 20, 21, 23}) {
+    map.insert(i, std::string(1, letters[i]));
+  }
+
+  EXPECT_EQ(map.aggregate(), letters);
+  EXPECT_EQ(map.aggregate(3, 11), "defghijk");
+  map.erase(5);
+  EXPECT_EQ(map.aggregate(3, 11), "deghijk");
+}
+
+TEST(AggregateMap, MatchesBruteForceUnderChurn) {
+  std::mt19937 rng(11);
+  std::uniform_int_distribution<int> key(0, 2000);
+  s21::aggregate_map<int, std::int64_t> map;
+  std::map<int, std::int64_t> reference;
+
+  for (int round = 0; round < 5000; ++round) {
+    int k = key(rng);
+    switch (round % 4) {
+      case 0:
+        map.accumulate(k, round);
+        reference[k] += round;
+        break;
+      case 1:
+        map.insert_or_assign(k, -round);
+        reference[k] = -round;
+        break;
+      case 2:
+        EXPECT_EQ(map.erase(k), reference.erase(k));
+        break;
+      default: {
+        int lower = key(rng);
+        int upper = lower + key(rng) / 8;
+        std::int64_t expected = 0;
+        for (auto it = reference.lower_bound(lower);
+             it != reference.end() && it->first < upper; ++it) {
+          expected += it->second;
+        }
+        EXPECT_EQ(map.aggregate(lower, upper), expected);
+      }
+    }
+  }
+  EXPECT_EQ(map.size(), reference.size());
+}
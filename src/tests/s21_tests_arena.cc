@@ -0,0 +1,44 @@
+#include <cstdint>
+#include <memory>
+
+#include "../s21_arena.h"
+#include "s21_tests.h"
+
+TEST(Arena, AlignedAllocations) {
+  s21::arena pool(256);
+  void *a = pool.allocate(3, 1);
+  void *b = pool.allocate(8, 8);
+  void *c = pool.allocate(16, 64);
+
+  EXPECT_NE(a, b);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 8, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c) % 64, 0);
+  EXPECT_GE(pool.reserved(), 256);
+}
+
+TEST(Arena, OversizedRequestGetsOwnBlock) {
+  s21::arena pool(128);
+  pool.allocate(16, 8);
+  std::size_t before = pool.reserved();
+  pool.allocate(4096, 8);
+
+  EXPECT_GE(pool.reserved(), before + 4096);
+}
+
+TEST(Arena, AllocatorSharesArenaAcrossRebind) {
+  s21::arena_allocator<int> ints;
+  EXPECT_EQ(ints.resource(), nullptr);
+  int *value = ints.allocate(1);
+  *value = 42;
+  ints.deallocate(value, 1);
+
+  s21::arena_allocator<double> doubles(ints);
+  EXPECT_TRUE(doubles == ints);
+  EXPECT_TRUE(s21::arena_allocator<int>() != ints);
+  EXPECT_EQ(ints.resource().use_count(), 2);
+}
+
+TEST(Arena, Trait) {
+  EXPECT_TRUE(s21::is_arena_allocator<s21::arena_allocator<int>>::value);
+  EXPECT_FALSE(s21::is_arena_allocator<std::allocator<int>>::value);
+}
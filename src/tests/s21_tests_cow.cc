@@ -0,0 +1,92 @@
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_tests.h"
+
+TEST(Cow, CopySharesUntilWrite) {
+  s21::cow_map<int, std::string> original{{1, "one"}, {2, "two"}};
+  s21::cow_map<int, std::string> copy(original);
+  EXPECT_EQ(&*copy, &*original);
+  EXPECT_EQ(original.use_count(), 2U);
+  EXPECT_TRUE(copy.shared());
+
+  copy.write()[3] = "three";
+  EXPECT_NE(&*copy, &*original);
+  EXPECT_FALSE(original.shared());
+  EXPECT_FALSE(copy.shared());
+  EXPECT_EQ(copy->size(), 3U);
+  EXPECT_EQ(original->size(), 2U);
+  EXPECT_FALSE(original->contains(3));
+
+  const s21::map<int, std::string> *unique = &*copy;
+  copy.write().erase(1);
+  EXPECT_EQ(&*copy, unique);
+  EXPECT_EQ(*original->find(1), "one");
+}
+
+TEST(Cow, CopyAllocatesNoNodes) {
+  using stats_set = s21::set<int, std::less<int>, std::allocator<int>,
+                             s21::tree_stats>;
+  s21::cow<stats_set> original;
+  for (int i = 0; i < 1000; ++i) original.write().insert(i);
+  const s21::tree_stats &stats = original->stats();
+  EXPECT_EQ(stats.allocations, 1000);
+
+  std::vector<s21::cow<stats_set>> copies(100, original);
+  EXPECT_EQ(stats.allocations, 1000);
+  EXPECT_EQ(original.use_count(), 101U);
+
+  copies[7].write().insert(-1);
+  EXPECT_EQ(stats.allocations, 1000);
+  EXPECT_EQ(copies[7]->size(), 1001U);
+  EXPECT_EQ(copies[7]->stats().allocations, 1001);
+  EXPECT_EQ(original.use_count(), 100U);
+}
+
+TEST(Cow, MoveAndAssign) {
+  s21::cow_set<int> first{3, 1, 2};
+  s21::cow_set<int> second(std::move(first));
+  EXPECT_TRUE(first->empty());
+  EXPECT_EQ(first.use_count(), 0U);
+  EXPECT_EQ(second->size(), 3U);
+
+  first.write().insert(9);
+  EXPECT_EQ(*first->begin(), 9);
+  first = second;
+  EXPECT_EQ(&*first, &*second);
+  second = s21::cow_set<int>();
+  EXPECT_FALSE(first.shared());
+  EXPECT_EQ(first->size(), 3U);
+
+  s21::cow_multiset<int> multi{1, 1, 2};
+  s21::cow_multiset<int> other = multi;
+  other.write().insert(1);
+  EXPECT_EQ(multi->count(1), 2U);
+  EXPECT_EQ(other->count(1), 3U);
+}
+
+TEST(Cow, CopiesAcrossThreads) {
+  s21::cow_map<int, int> shared;
+  for (int i = 0; i < 1000; ++i) shared.write().insert(i, i);
+
+  std::vector<std::thread> threads;
+  std::vector<long> sums(8);
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([copy = shared, t, &sums]() mutable {
+      long sum = 0;
+      for (int round = 0; round < 20; ++round) {
+        s21::cow_map<int, int> local(copy);
+        for (auto it = local->begin(); it != local->end(); ++it) sum += *it;
+        if (t % 2) local.write()[t] = -1;
+      }
+      if (t % 2) copy.write().erase(t);
+      sums[t] = sum;
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  for (int t = 0; t < 8; ++t) EXPECT_EQ(sums[t], 20 * 499500L);
+  EXPECT_EQ(shared.use_count(), 1U);
+  EXPECT_EQ(shared->size(), 1000U);
+}
@@ -0,0 +1,179 @@
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+using namespace std::string_view_literals;
+
+constexpr auto kMethods = s21::make_frozen_map<std::string_view, int>({
+    {"GET", 1},
+    {"HEAD", 2},
+    {"POST", 3},
+    {"PUT", 4},
+    {"DELETE", 5},
+    {"CONNECT", 6},
+    {"OPTIONS", 7},
+    {"TRACE", 8},
+    {"PATCH", 9},
+});
+static_assert(decltype(kMethods)::kHashed);
+static_assert(kMethods.size() == 9);
+static_assert(kMethods.at("PATCH") == 9);
+static_assert(kMethods.contains("TRACE"));
+static_assert(!kMethods.contains("get"));
+static_assert(kMethods.find("LINK") == kMethods.end());
+static_assert(kMethods.begin().key() == "CONNECT");
+
+constexpr auto kSmall = s21::make_frozen_set<int>({30, 10, 20});
+static_assert(!decltype(kSmall)::kHashed);
+static_assert(kSmall.contains(20) && !kSmall.contains(25));
+static_assert(*kSmall.begin() == 10);
+
+enum class color { red, green, blue };
+
+constexpr auto kColors = s21::make_frozen_map<color, std::string_view>(
+    {{color::blue, "blue"}, {color::red, "red"}, {color::green, "green"}});
+static_assert(kColors.at(color::green) == "green");
+
+struct generated_keys {
+  long keys[1000];
+};
+
+constexpr generated_keys make_keys() {
+  generated_keys result{};
+  for (long i = 0; i < 1000; ++i) result.keys[i] = i * 7919 % 100003 - 500;
+  return result;
+}
+
+constexpr generated_keys kGenerated = make_keys();
+constexpr s21::frozen_set<long, 1000> kLarge(kGenerated.keys);
+static_assert(decltype(kLarge)::kHashed);
+static_assert(kLarge.contains(-500));
+static_assert(kLarge.contains(999 * 7919 % 100003 - 500));
+
+// Keys without a frozen_hash fall back to binary search
+struct version {
+  int major, minor;
+  constexpr bool operator<(const version &other) const {
+    return major != other.major ? major < other.major : minor < other.minor;
+  }
+};
+
+constexpr auto kReleases = s21::make_frozen_map<version, std::string_view>({
+    {{1, 2}, "b"}, {{1, 0}, "a"}, {{2, 0}, "c"}, {{0, 9}, "pre"},
+    {{3, 1}, "e"}, {{3, 0}, "d"}, {{4, 0}, "f"}, {{5, 0}, "g"},
+});
+static_assert(!decltype(kReleases)::kHashed);
+static_assert(kReleases.at({3, 0}) == "d");
+static_assert(!kReleases.contains({2, 1}));
+
+// Keys equivalent under Compare are found on both lookup paths, even when
+// they are not ==
+struct by_decade {
+  constexpr bool operator()(int a, int b) const { return a / 10 < b / 10; }
+};
+
+struct decade_hash {
+  constexpr std::uint64_t operator()(int key, std::uint64_t seed) const {
+    return s21::frozen_hash<int>()(key / 10, seed);
+  }
+};
+
+constexpr int kDecades[] = {0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
+constexpr s21::frozen_set<int, 10, by_decade, decade_hash> kHashedDecades(
+    kDecades);
+static_assert(decltype(kHashedDecades)::kHashed);
+static_assert(kHashedDecades.contains(45) && *kHashedDecades.find(97) == 90);
+static_assert(!kHashedDecades.contains(100));
+
+constexpr int kFewDecades[] = {0, 10, 20};
+constexpr s21::frozen_set<int, 3, by_decade, decade_hash> kSortedDecades(
+    kFewDecades);
+static_assert(!decltype(kSortedDecades)::kHashed);
+static_assert(kSortedDecades.contains(15) && !kSortedDecades.contains(35));
+
+// A custom Compare without its own Hash falls back to binary search, since
+// frozen_hash would send equivalent keys to different buckets
+struct ignore_case {
+  static constexpr char lower(char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+  }
+  constexpr bool operator()(std::string_view a, std::string_view b) const {
+    for (std::size_t i = 0; i < a.size() && i < b.size(); ++i) {
+      if (lower(a[i]) != lower(b[i])) return lower(a[i]) < lower(b[i]);
+    }
+    return a.size() < b.size();
+  }
+};
+
+constexpr auto kHeaders = s21::make_frozen_set<std::string_view, ignore_case>(
+    {"Accept"sv, "Allow"sv, "Connection"sv, "Content-Length"sv,
+     "Content-Type"sv, "Date"sv, "Host"sv, "Location"sv, "Server"sv,
+     "User-Agent"sv});
+static_assert(!decltype(kHeaders)::kHashed);
+static_assert(s21::frozen_set<std::string_view, 10, std::less<>>::kHashed);
+}  // namespace
+
+TEST(Frozen, MapLookups) {
+  EXPECT_EQ(kMethods.at("GET"), 1);
+  EXPECT_EQ(*kMethods.find("DELETE"), 5);
+  EXPECT_EQ(kMethods.find("DELETE").key(), "DELETE");
+  EXPECT_EQ(kMethods.count("OPTIONS"), 1U);
+  EXPECT_EQ(kMethods.count("options"), 0U);
+  EXPECT_THROW(kMethods.at("BREW"), std::out_of_range);
+  std::string dynamic = "PO";
+  dynamic += "ST";
+  EXPECT_TRUE(kMethods.contains(dynamic));
+}
+
+TEST(Frozen, OrderedIteration) {
+  std::vector<std::string_view> keys;
+  for (auto it = kMethods.begin(); it != kMethods.end(); ++it) {
+    keys.push_back(it.key());
+    EXPECT_EQ(kMethods.at(it.key()), *it);
+  }
+  EXPECT_EQ(keys, (std::vector<std::string_view>{
+                      "CONNECT", "DELETE", "GET", "HEAD", "OPTIONS", "PATCH",
+                      "POST", "PUT", "TRACE"}));
+  EXPECT_EQ(*std::prev(kReleases.end()), "g");
+  EXPECT_EQ(std::distance(kLarge.begin(), kLarge.end()), 1000);
+}
+
+TEST(Frozen, EveryKeyFound) {
+  for (long key : kGenerated.keys) {
+    EXPECT_TRUE(kLarge.contains(key));
+    EXPECT_EQ(*kLarge.find(key), key);
+  }
+  int absent = 0;
+  for (long key = -600; key < 100003; key += 13) {
+    absent += !kLarge.contains(key);
+  }
+  EXPECT_GT(absent, 6000);
+  EXPECT_EQ(kLarge.find(100004), kLarge.end());
+}
+
+TEST(Frozen, CustomCompareWithDefaultHash) {
+  for (std::string_view name : {"content-type", "CONTENT-LENGTH", "host",
+                                "uSeR-aGeNt", "accept", "SERVER"}) {
+    EXPECT_TRUE(kHeaders.contains(name)) << name;
+  }
+  EXPECT_EQ(*kHeaders.find("LOCATION"), "Location");
+  EXPECT_FALSE(kHeaders.contains("content"));
+  EXPECT_FALSE(kHeaders.contains("Referer"));
+}
+
+TEST(Frozen, RuntimeConstruction) {
+  const std::string_view words[] = {"delta", "alpha", "charlie", "bravo"};
+  s21::frozen_set<std::string_view, 4> set(words);
+  EXPECT_EQ(*set.begin(), "alpha");
+  EXPECT_TRUE(set.contains("charlie"));
+
+  const std::string_view twice[] = {"a", "b", "a"};
+  EXPECT_THROW((s21::frozen_set<std::string_view, 3>(twice)),
+               std::invalid_argument);
+}
@@ -0,0 +1,147 @@
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_tests.h"
+
+TEST(IndexedHeap, PushPopInOrder) {
+  s21::indexed_heap<int> heap;
+  for (int value : {7, 3, 9, 1, 5}) heap.push(value);
+
+  std::vector<int> popped;
+  while (!heap.empty()) {
+    popped.push_back(heap.top());
+    heap.pop();
+  }
+  EXPECT_EQ(popped, (std::vector<int>{1, 3, 5, 7, 9}));
+}
+
+TEST(IndexedHeap, DecreaseIncreaseKey) {
+  s21::indexed_heap<int> heap;
+  auto a = heap.push(10);
+  auto b = heap.push(20);
+  auto c = heap.push(30);
+
+  heap.decrease_key(c, 5);
+  EXPECT_EQ(heap.top(), 5);
+  EXPECT_EQ(heap.top_handle(), c);
+  heap.increase_key(c, 25);
+  EXPECT_EQ(heap.top_handle(), a);
+  heap.update(b, 1);
+  EXPECT_EQ(heap.top_handle(), b);
+  EXPECT_EQ(heap.get(c), 25);
+
+  EXPECT_THROW(heap.decrease_key(a, 11), std::invalid_argument);
+  EXPECT_THROW(heap.increase_key(a, 9), std::invalid_argument);
+}
+
+TEST(IndexedHeap, EraseAndStaleHandles) {
+  s21::indexed_heap<std::string, std::greater<std::string>> heap;
+  auto a = heap.push("apple");
+  auto b = heap.emplace(3, 'z');
+  heap.push("mango");
+
+  EXPECT_EQ(heap.top(), "zzz");
+  heap.erase(b);
+  EXPECT_FALSE(heap.contains(b));
+  EXPECT_EQ(heap.top(), "mango");
+  EXPECT_THROW(heap.erase(b), std::out_of_range);
+  EXPECT_THROW(heap.get(100), std::out_of_range);
+
+  auto reused = heap.push("kiwi");
+  EXPECT_EQ(reused, b);
+  EXPECT_EQ(heap.get(a), "apple");
+  EXPECT_EQ(heap.size(), 3);
+}
+
+TEST(IndexedHeap, MatchesReferenceUnderChurn) {
+  std::mt19937 rng(21);
+  s21::indexed_heap<int, std::less<int>, 3> heap;
+  std::map<std::size_t, int> live;  // handle -> value
+
+  for (int step = 0; step < 20000; ++step) {
+    unsigned action = rng() % 5;
+    if (live.empty() || action == 0) {
+      int value = rng() % 10000;
+      live[heap.push(value)] = value;
+    } else {
+      auto it = live.begin();
+      std::advance(it, rng() % live.size());
+      if (action == 1) {
+        heap.erase(it->first);
+        live.erase(it);
+      } else if (action == 2) {
+        int value = it->second - static_cast<int>(rng() % 100);
+        heap.decrease_key(it->first, value);
+        it->second = value;
+      } else if (action == 3) {
+        int value = rng() % 10000;
+        heap.update(it->first, value);
+        it->second = value;
+      } else {
+        int least = live.begin()->second;
+        for (const auto &item : live) least = std::min(least, item.second);
+        ASSERT_EQ(heap.top(), least);
+        live.erase(heap.top_handle());
+        heap.pop();
+      }
+    }
+    ASSERT_EQ(heap.size(), live.size());
+  }
+  for (const auto &item : live) EXPECT_EQ(heap.get(item.first), item.second);
+}
+
+TEST(IndexedHeap, ClearAndMemory) {
+  s21::indexed_heap<double> heap;
+  heap.reserve(16);
+  for (int i = 0; i < 10; ++i) heap.push(i * 0.5);
+
+  auto report = heap.memory_usage();
+  EXPECT_EQ(report.payload_bytes, 10 * sizeof(double));
+  EXPECT_EQ(report.allocations, 2);
+
+  heap.clear();
+  EXPECT_TRUE(heap.empty());
+  EXPECT_EQ(heap.push(1.0), 0);
+}
+
+namespace {
+// Throws from its constructor on a negative value, and from its move
+// constructor once the value was marked fragile
+struct fragile {
+  explicit fragile(int v, bool f = false) : value(v), throw_on_move(f) {
+    if (v < 0) throw std::invalid_argument("negative");
+  }
+  fragile(fragile &&other) : value(other.value), throw_on_move(false) {
+    if (other.throw_on_move) throw std::runtime_error("move");
+  }
+  fragile &operator=(fragile &&other) = default;
+  bool operator<(const fragile &other) const { return value < other.value; }
+
+  int value;
+  bool throw_on_move;
+};
+}  // namespace
+
+TEST(IndexedHeap, FailedEmplaceKeepsHandles) {
+  s21::indexed_heap<fragile> heap;
+  auto a = heap.emplace(5);
+  auto b = heap.emplace(7);
+  heap.erase(a);
+
+  EXPECT_THROW(heap.emplace(-1), std::invalid_argument);
+  EXPECT_THROW(heap.emplace(1, true), std::runtime_error);
+  EXPECT_EQ(heap.size(), 1);
+  EXPECT_FALSE(heap.contains(a));
+  EXPECT_EQ(heap.emplace(3), a);
+
+  EXPECT_THROW(heap.emplace(1, true), std::runtime_error);
+  EXPECT_FALSE(heap.contains(2));
+  EXPECT_EQ(heap.emplace(4), 2);
+  EXPECT_EQ(heap.top().value, 3);
+  EXPECT_EQ(heap.get(b).value, 7);
+}
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+using interval_map = s21::interval_map<int, int>;
+
+std::vector<std::pair<int, int>> intervals_of(
+    const std::vector<interval_map::iterator> &found) {
+  std::vector<std::pair<int, int>> result;
+  for (const auto &it : found) result.push_back(it.interval());
+  return result;
+}
+}  // namespace
+
+TEST(IntervalMap, InsertFind) {
+  interval_map map{{{1, 5}, 10}, {{3, 4}, 20}, {{1, 2}, 30}};
+
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_TRUE(map.contains(3, 4));
+  EXPECT_FALSE(map.contains(3, 5));
+  EXPECT_EQ(*map.find(1, 2), 30);
+  EXPECT_EQ(map.find(2, 2), map.end());
+  EXPECT_EQ(map.at(1, 5), 10);
+  EXPECT_THROW(map.at(0, 0), std::out_of_range);
+  EXPECT_FALSE(map.insert(1, 5, 99).second);
+  EXPECT_EQ(map.at(1, 5), 10);
+  map.insert_or_assign(1, 5, 99);
+  EXPECT_EQ(map.at(1, 5), 99);
+}
+
+TEST(IntervalMap, OrderedIteration) {
+  interval_map map{{{4, 9}, 1}, {{1, 7}, 2}, {{1, 3}, 3}, {{6, 6}, 4}};
+  std::vector<std::pair<int, int>> expected{{1, 3}, {1, 7}, {4, 9}, {6, 6}};
+  std::vector<std::pair<int, int>> actual;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    actual.push_back(it.interval());
+  }
+
+  EXPECT_EQ(actual, expected);
+  EXPECT_EQ((--map.end()).lower(), 6);
+}
+
+TEST(IntervalMap, RejectsReversedInterval) {
+  interval_map map;
+  EXPECT_THROW(map.insert(5, 1, 0), std::invalid_argument);
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(IntervalMap, StabAndOverlap) {
+  interval_map map{{{0, 10}, 0}, {{2, 3}, 1}, {{5, 8}, 2}, {{8, 8}, 3},
+                   {{9, 20}, 4}, {{12, 15}, 5}};
+  std::vector<interval_map::iterator> found;
+
+  map.stab(8, std::back_inserter(found));
+  EXPECT_EQ(intervals_of(found),
+            (std::vector<std::pair<int, int>>{{0, 10}, {5, 8}, {8, 8}}));
+
+  found.clear();
+  map.overlap(4, 9, std::back_inserter(found));
+  EXPECT_EQ(intervals_of(found), (std::vector<std::pair<int, int>>{
+                                     {0, 10}, {5, 8}, {8, 8}, {9, 20}}));
+
+  found.clear();
+  map.stab(21, std::back_inserter(found));
+  EXPECT_TRUE(found.empty());
+
+  EXPECT_TRUE(map.overlaps(11, 11));
+  EXPECT_FALSE(map.overlaps(21, 30));
+  EXPECT_FALSE(map.overlaps(-5, -1));
+}
+
+TEST(IntervalMap, MatchesBruteForceUnderChurn) {
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> point(0, 1000);
+  std::uniform_int_distribution<int> length(0, 60);
+  interval_map map;
+  std::vector<std::pair<int, int>> reference;
+
+  for (int round = 0; round < 3000; ++round) {
+    if (round % 3 == 2 && !reference.empty()) {
+      auto victim = reference[rng() % reference.size()];
+      EXPECT_EQ(map.erase(victim.first, victim.second), 1);
+      reference.erase(
+          std::find(reference.begin(), reference.end(), victim));
+    } else {
+      int lower = point(rng);
+      int upper = lower + length(rng);
+      if (map.insert(lower, upper, round).second) {
+        reference.emplace_back(lower, upper);
+      }
+    }
+  }
+  std::sort(reference.begin(), reference.end());
+  ASSERT_EQ(map.size(), reference.size());
+
+  for (int query = 0; query < 200; ++query) {
+    int lower = point(rng);
+    int upper = lower + length(rng) / 4;
+    std::vector<std::pair<int, int>> expected;
+    for (const auto &item : reference) {
+      if (item.first <= upper && lower <= item.second) {
+        expected.push_back(item);
+      }
+    }
+    std::vector<interval_map::iterator> found;
+    map.overlap(lower, upper, std::back_inserter(found));
+    EXPECT_EQ(intervals_of(found), expected);
+    EXPECT_EQ(map.overlaps(lower, upper), !expected.empty());
+  }
+}
+
+TEST(IntervalMap, EraseByIterator) {
+  s21::interval_map<double, std::string> map{{{0.5, 1.5}, "a"},
+                                             {{1.0, 2.0}, "b"}};
+  map.erase(map.find(0.5, 1.5));
+
+  std::vector<s21::interval_map<double, std::string>::iterator> found;
+  map.stab(1.2, std::back_inserter(found));
+  ASSERT_EQ(found.size(), 1);
+  EXPECT_EQ(*found[0], "b");
+  EXPECT_EQ(map.memory_usage().allocations, 2);
+}
@@ -1059,4 +1059,69 @@ TEST(ListSort, StringSort) {
     EXPECT_EQ(*it, val);
     ++it;
   }
-}
\ No newline at end of file
+}
+TEST(ListTest, MoveCtorRelinksNodes) {
+  list<int> list1{1, 2, 3};
+  list<int> list2(std::move(list1));
+
+  int expected = 1;
+  for (int value : list2) EXPECT_EQ(value, expected++);
+  EXPECT_EQ(expected, 4);
+  EXPECT_EQ(*--list2.end(), 3);
+  EXPECT_EQ(*++list2.end(), 1);
+  EXPECT_EQ(list1.begin(), list1.end());
+  list1.push_back(4);
+  EXPECT_EQ(list1.front(), 4);
+}
+
+TEST(ListClear, LargeList) {
+  list<int> list1;
+  for (int i = 0; i < 100000; ++i) list1.push_back(i);
+  list1.clear();
+
+  EXPECT_TRUE(list1.empty());
+  EXPECT_EQ(list1.begin(), list1.end());
+  list1.push_back(1);
+  EXPECT_EQ(list1.back(), 1);
+}
+
+TEST(ListClear, Async) {
+  list<std::string> list1;
+  for (int i = 0; i < 1000; ++i) list1.push_back(std::to_string(i));
+  auto done = list1.clear_async();
+
+  EXPECT_TRUE(list1.empty());
+  list1.push_back("next");
+  EXPECT_EQ(list1.front(), "next");
+  done.get();
+}
+
+TEST(ListClear, ClearKeepsSuppliedArena) {
+  auto pool = std::make_shared<s21::arena>(4096);
+  list<int, s21::arena_allocator<int>> list1{s21::arena_allocator<int>(pool)};
+  for (int i = 0; i < 1000; ++i) list1.push_back(i);
+  list1.clear();
+
+  EXPECT_EQ(list1.get_allocator().resource(), pool);
+  std::size_t reserved = pool->reserved();
+  for (int i = 0; i < 1000; ++i) list1.push_back(i);
+  EXPECT_GT(pool->reserved(), reserved);
+  list1.clear_async().get();
+  EXPECT_EQ(list1.get_allocator().resource(), pool);
+  EXPECT_FALSE(list1.get_allocator().owns_arena());
+}
+
+TEST(ListClear, ArenaAllocator) {
+  list<int, s21::arena_allocator<int>> list1{1, 2, 3};
+  list1.clear();
+  list1.push_back(4);
+  EXPECT_EQ(list1.size(), 1);
+  EXPECT_EQ(list1.front(), 4);
+  list1.clear_async().get();
+  EXPECT_TRUE(list1.empty());
+
+  list<std::string, s21::arena_allocator<std::string>> list2;
+  list2.push_back(std::string(100, 'x'));
+  list2.clear();
+  EXPECT_TRUE(list2.empty());
+}
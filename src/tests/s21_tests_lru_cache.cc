@@ -0,0 +1,145 @@
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_tests.h"
+
+TEST(LruCache, GetPutEvict) {
+  s21::lru_cache<int, std::string> cache(2);
+  std::vector<std::pair<int, std::string>> evicted;
+  cache.on_evict([&evicted](const int &key, std::string &value) {
+    evicted.emplace_back(key, value);
+  });
+
+  EXPECT_TRUE(cache.put(1, "one"));
+  EXPECT_TRUE(cache.put(2, "two"));
+  ASSERT_NE(cache.get(1), nullptr);
+  EXPECT_TRUE(cache.put(3, "three"));
+
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.get(2), nullptr);
+  EXPECT_EQ(*cache.get(1), "one");
+  EXPECT_EQ(*cache.peek(3), "three");
+  ASSERT_EQ(evicted.size(), 1);
+  EXPECT_EQ(evicted[0], std::make_pair(2, std::string("two")));
+  EXPECT_EQ(cache.hits(), 2);
+  EXPECT_EQ(cache.misses(), 1);
+}
+
+TEST(LruCache, ReplaceEraseClear) {
+  s21::lru_cache<int, int> cache(3);
+  cache.put(1, 10);
+  cache.put(2, 20);
+  cache.put(1, 11);
+  cache.put(3, 30);
+  cache.put(4, 40);
+
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_EQ(*cache.peek(1), 11);
+  EXPECT_TRUE(cache.erase(3));
+  EXPECT_FALSE(cache.erase(3));
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.weight(), 2);
+
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.weight(), 0);
+  cache.put(5, 50);
+  EXPECT_EQ(*cache.get(5), 50);
+}
+
+TEST(LruCache, ByteWeight) {
+  struct by_length {
+    std::size_t operator()(const int &, const std::string &value) const {
+      return value.size();
+    }
+  };
+  s21::lru_cache<int, std::string, by_length> cache(10, s21::lru_policy::lru,
+                                                    by_length());
+
+  cache.put(1, "aaaa");
+  cache.put(2, "bbbb");
+  cache.put(3, "cc");
+  EXPECT_EQ(cache.weight(), 10);
+  cache.put(4, "d");
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_EQ(cache.weight(), 7);
+
+  EXPECT_FALSE(cache.put(5, std::string(11, 'x')));
+  EXPECT_FALSE(cache.contains(5));
+  cache.put(2, "bbbbbbbbbb");
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.weight(), 10);
+
+  cache.set_capacity(5);
+  EXPECT_TRUE(cache.empty());
+}
+
+TEST(LruCache, SegmentedResistsScans) {
+  s21::lru_cache<int, int> plain(10);
+  s21::lru_cache<int, int> segmented(10, s21::lru_policy::segmented);
+  for (auto *cache : {&plain, &segmented}) {
+    for (int round = 0; round < 2; ++round) {
+      for (int key = 0; key < 5; ++key) {
+        if (!cache->get(key)) cache->put(key, key);
+      }
+    }
+    for (int key = 100; key < 120; ++key) cache->put(key, key);
+  }
+
+  int plain_hot = 0, segmented_hot = 0;
+  for (int key = 0; key < 5; ++key) {
+    plain_hot += plain.contains(key);
+    segmented_hot += segmented.contains(key);
+  }
+  EXPECT_EQ(plain_hot, 0);
+  EXPECT_EQ(segmented_hot, 5);
+  EXPECT_EQ(segmented.size(), 10);
+}
+
+TEST(LruCache, MatchesReferenceModel) {
+  std::mt19937 rng(3);
+  s21::lru_cache<int, int> cache(16);
+  std::list<std::pair<int, int>> model;  // front is most recent
+  auto locate = [&model](int key) {
+    for (auto it = model.begin(); it != model.end(); ++it) {
+      if (it->first == key) return it;
+    }
+    return model.end();
+  };
+
+  for (int step = 0; step < 5000; ++step) {
+    int key = rng() % 40;
+    auto it = locate(key);
+    if (step % 2) {
+      int *value = cache.get(key);
+      ASSERT_EQ(value != nullptr, it != model.end());
+      if (value) {
+        EXPECT_EQ(*value, it->second);
+        model.splice(model.begin(), model, it);
+      }
+    } else {
+      cache.put(key, step);
+      if (it != model.end()) model.erase(it);
+      model.emplace_front(key, step);
+      if (model.size() > 16) model.pop_back();
+    }
+    ASSERT_EQ(cache.size(), model.size());
+  }
+}
+
+TEST(LruCache, Move) {
+  s21::lru_cache<int, int> cache(2, s21::lru_policy::segmented);
+  cache.put(1, 1);
+  cache.get(1);
+  cache.put(2, 2);
+
+  s21::lru_cache<int, int> moved(std::move(cache));
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(*moved.get(2), 2);
+  moved.put(3, 3);
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(moved.memory_usage().allocations, 3);
+}
@@ -1,7 +1,11 @@
 #include <cstddef>
+#include <cstdio>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "s21_tests.h"
 
@@ -221,4 +225,197 @@ TEST(Map, MaxSize1) {
       std::numeric_limits<std::ptrdiff_t>::max() / (3 * sizeof(void *));
 
   EXPECT_EQ(map_s21.max_size(), expected);
-}
\ No newline at end of file
+}
+TEST(Map, Freeze1) {
+  s21::map<int, std::string> map_s21;
+  std::map<int, std::string> map_std;
+  for (int i = 0; i < 500; ++i) {
+    int key = (i * 7919) % 1009;
+    map_s21.insert(key, std::to_string(i));
+    map_std.insert({key, std::to_string(i)});
+  }
+  auto frozen = map_s21.freeze();
+
+  EXPECT_EQ(frozen.size(), map_std.size());
+  for (int key = 0; key < 1009; ++key) {
+    auto it = frozen.find(key);
+    if (map_std.count(key)) {
+      EXPECT_EQ(*it, map_std.at(key));
+      EXPECT_EQ(frozen.at(key), map_std.at(key));
+    } else {
+      EXPECT_EQ(it, frozen.end());
+      EXPECT_THROW(frozen.at(key), std::out_of_range);
+    }
+  }
+}
+
+TEST(Map, FreezeIteration1) {
+  s21::map<int, int> map_s21{{5, 50}, {1, 10}, {3, 30}, {4, 40}, {2, 20}};
+  auto frozen = map_s21.freeze();
+
+  int key = 1;
+  for (auto it = frozen.begin(); it != frozen.end(); ++it, ++key) {
+    EXPECT_EQ(it.key(), key);
+    EXPECT_EQ(*it, key * 10);
+  }
+  EXPECT_EQ(frozen.lower_bound(6), frozen.end());
+  EXPECT_EQ(frozen.lower_bound(0).key(), 1);
+}
+
+TEST(Map, Find1) {
+  s21::map<int, int> map_s21{{1, 2}, {3, 4}, {5, 6}};
+
+  EXPECT_EQ(*map_s21.find(3), 4);
+  EXPECT_EQ(map_s21.find(4), map_s21.end());
+}
+
+TEST(Map, FindMany1) {
+  s21::map<int, int> map_s21;
+  for (int i = 0; i < 1000; i += 2) map_s21.insert(i, i * 10);
+  std::vector<int> keys;
+  for (int i = -5; i < 1005; ++i) keys.push_back((i * 37) % 1010);
+
+  std::vector<s21::map<int, int>::iterator> found;
+  map_s21.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+  std::vector<char> present(keys.size());
+  map_s21.contains_many(keys.begin(), keys.end(), present.begin());
+
+  ASSERT_EQ(found.size(), keys.size());
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    bool expected = keys[i] >= 0 && keys[i] < 1000 && keys[i] % 2 == 0;
+    EXPECT_EQ(present[i], expected);
+    EXPECT_EQ(found[i] != map_s21.end(), expected);
+    if (expected) {
+      EXPECT_EQ(*found[i], keys[i] * 10);
+    }
+  }
+}
+
+TEST(Map, FindManyEmpty1) {
+  s21::map<int, int> map_s21;
+  int keys[] = {1, 2, 3};
+  bool present[] = {true, true, true};
+
+  map_s21.contains_many(keys, keys + 3, present);
+
+  EXPECT_FALSE(present[0] || present[1] || present[2]);
+}
+
+TEST(Map, SaveLoad1) {
+  const std::string path = testing::TempDir() + "s21_map_snapshot.bin";
+  s21::map<int, double> map_s21;
+  for (int i = 0; i < 1000; ++i) map_s21.insert((i * 7919) % 1009, i * 0.5);
+  map_s21.save(path);
+
+  auto loaded = s21::map<int, double>::load(path);
+
+  EXPECT_EQ(loaded.size(), map_s21.size());
+  EXPECT_TRUE(std::equal(loaded.begin(), loaded.end(), map_s21.begin(),
+                         map_s21.end()));
+  for (int key = 0; key < 1009; ++key) {
+    EXPECT_EQ(loaded.contains(key), map_s21.contains(key));
+  }
+  loaded.insert(2000, 1.0);
+  loaded.erase(0);
+  EXPECT_EQ(loaded.size(), map_s21.size());
+  std::remove(path.c_str());
+}
+
+TEST(Map, SnapshotOpen1) {
+  const std::string path = testing::TempDir() + "s21_map_mapped.bin";
+  s21::map<int, int> map_s21;
+  for (int i = 0; i < 300; ++i) map_s21.insert(i * 2, i);
+  map_s21.save(path);
+
+  auto mapped = s21::eytzinger_map<int, int>::open(path);
+
+  EXPECT_EQ(mapped.size(), 300);
+  EXPECT_EQ(mapped.at(100), 50);
+  EXPECT_FALSE(mapped.contains(101));
+  EXPECT_EQ(mapped.lower_bound(101).key(), 102);
+  int expected = 0;
+  for (auto value : mapped) EXPECT_EQ(value, expected++);
+  mapped.save(path + ".copy");
+  EXPECT_EQ((s21::map<int, int>::load(path + ".copy").size()), 300);
+  std::remove(path.c_str());
+  std::remove((path + ".copy").c_str());
+}
+
+TEST(Map, SnapshotEmpty1) {
+  const std::string path = testing::TempDir() + "s21_map_empty.bin";
+  s21::map<int, int> map_s21;
+  map_s21.save(path);
+
+  EXPECT_TRUE((s21::map<int, int>::load(path).empty()));
+  EXPECT_TRUE((s21::eytzinger_map<int, int>::open(path).empty()));
+  std::remove(path.c_str());
+}
+
+TEST(Map, SnapshotRejectsBadFiles1) {
+  const std::string path = testing::TempDir() + "s21_map_bad.bin";
+  s21::map<int, int> map_s21{{1, 2}, {3, 4}};
+  map_s21.save(path);
+
+  EXPECT_THROW((s21::map<int, long>::load(path)), std::runtime_error);
+  EXPECT_THROW(s21::set<int>::load(path), std::runtime_error);
+  std::FILE *file = std::fopen(path.c_str(), "r+b");
+  std::fseek(file, 70, SEEK_SET);
+  std::fputc(0x7f, file);
+  std::fclose(file);
+  EXPECT_THROW((s21::map<int, int>::load(path)), std::runtime_error);
+  EXPECT_NO_THROW((s21::eytzinger_map<int, int>::open(path, false)));
+  EXPECT_THROW((s21::map<int, int>::load(path + ".missing")),
+               std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(Map_Stats_int_int, Counters) {
+  s21::map<int, int, std::less<int>,
+           std::allocator<std::pair<const int, int>>, s21::tree_stats>
+      cont_21;
+  for (int i = 0; i < 100; ++i) cont_21.insert(i, i);
+  cont_21.erase(50);
+
+  const auto &stats = cont_21.stats();
+  EXPECT_EQ(stats.allocations, 100);
+  EXPECT_EQ(stats.frees, 1);
+  EXPECT_EQ(cont_21.height(), 7);
+  EXPECT_LE(stats.max_depth, cont_21.height());
+}
+
+TEST(Map, ClearArenaNonTrivial1) {
+  s21::map<int, std::string, std::less<int>,
+           s21::arena_allocator<std::pair<const int, std::string>>>
+      cont_21;
+  for (int i = 0; i < 100; ++i) cont_21.insert(i, std::string(64, 'a'));
+  cont_21.clear();
+  EXPECT_TRUE(cont_21.empty());
+
+  cont_21.insert(1, "one");
+  auto done = cont_21.clear_async();
+  cont_21.insert(2, "two");
+  done.get();
+  EXPECT_EQ(cont_21.at(2), "two");
+  EXPECT_EQ(cont_21.size(), 1);
+}
+
+TEST(Map_Hint_int_int, HintedInsert) {
+  s21::map<int, int> map_s21;
+  std::map<int, int> map_std;
+  for (int i = 0; i < 1000; i += 10) {
+    map_s21[i] = i;
+    map_std[i] = i;
+  }
+  for (int i = 995; i > 0; i -= 10) {
+    auto hint = map_s21.find(i + 5);
+    auto it = map_s21.insert(hint, {i, -i});
+    EXPECT_EQ(*it, -i);
+    EXPECT_EQ(*map_s21.insert(it, {i, 0}), -i);
+    map_std.insert({i, -i});
+  }
+  map_s21.insert(map_s21.begin(), {2000, 1});
+  map_std.insert({2000, 1});
+  ASSERT_EQ(map_s21.size(), map_std.size());
+  auto it = map_s21.begin();
+  for (const auto &item : map_std) EXPECT_EQ(*it++, item.second);
+}
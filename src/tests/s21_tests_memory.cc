@@ -0,0 +1,105 @@
+#include <sstream>
+#include <string>
+
+#include "../s21_memory_registry.h"
+#include "s21_tests.h"
+
+TEST(Memory, Vector) {
+  s21::vector<int> vec;
+  EXPECT_EQ(vec.memory_usage().total_bytes(), 0);
+  EXPECT_EQ(vec.memory_usage().allocations, 0);
+
+  vec.reserve(10);
+  vec.push_back(1);
+  vec.push_back(2);
+  s21::memory_report report = vec.memory_usage();
+
+  EXPECT_EQ(report.payload_bytes, 2 * sizeof(int));
+  EXPECT_EQ(report.overhead_bytes, 8 * sizeof(int));
+  EXPECT_EQ(report.allocations, 1);
+}
+
+TEST(Memory, List) {
+  s21::list<double> lst{1.0, 2.0, 3.0};
+  s21::memory_report report = lst.memory_usage();
+
+  EXPECT_EQ(report.payload_bytes, 3 * sizeof(double));
+  EXPECT_GT(report.overhead_bytes, 3 * 2 * sizeof(void *) - 1);
+  EXPECT_EQ(report.allocations, 3);
+}
+
+TEST(Memory, Adaptors) {
+  s21::stack<int> stk{1, 2, 3};
+  s21::queue<int> que{1, 2, 3};
+
+  EXPECT_EQ(stk.memory_usage().payload_bytes, 3 * sizeof(int));
+  EXPECT_EQ(que.memory_usage().payload_bytes, 3 * sizeof(int));
+  EXPECT_EQ(que.memory_usage().allocations, 3);
+}
+
+TEST(Memory, Array) {
+  s21::array<int, 4> arr{};
+  s21::memory_report report = arr.memory_usage();
+
+  EXPECT_EQ(report.payload_bytes, 4 * sizeof(int));
+  EXPECT_EQ(report.overhead_bytes, 0);
+  EXPECT_EQ(report.allocations, 0);
+}
+
+TEST(Memory, Trees) {
+  s21::set<int> set{1, 2, 3};
+  s21::map<int, long> map{{1, 1}, {2, 2}};
+  s21::multiset<int> multiset{7, 7, 7, 8};
+
+  EXPECT_EQ(set.memory_usage().payload_bytes, 3 * sizeof(int));
+  EXPECT_EQ(set.memory_usage().allocations, 4);
+  EXPECT_EQ(map.memory_usage().payload_bytes, 2 * (sizeof(int) + sizeof(long)));
+  EXPECT_EQ(multiset.memory_usage().payload_bytes, 2 * sizeof(int));
+  EXPECT_EQ(multiset.memory_usage().allocations, 3);
+
+  set.erase(2);
+  multiset.erase(7);
+  EXPECT_EQ(set.memory_usage().allocations, 3);
+  EXPECT_EQ(multiset.memory_usage().allocations, 2);
+  set.clear();
+  EXPECT_EQ(set.memory_usage().allocations, 1);
+  EXPECT_EQ(set.memory_usage().payload_bytes, 0);
+}
+
+TEST(Memory, Registry) {
+  auto &registry = s21::memory_registry::instance();
+  s21::vector<int> vec{1, 2, 3, 4};
+  s21::list<int> lst{1, 2};
+  {
+    auto vec_handle = registry.track(vec, "vector");
+    auto lst_handle = registry.track(lst, "list");
+    auto entries = registry.entries();
+
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].label, "vector");
+    EXPECT_EQ(entries[1].label, "list");
+    EXPECT_EQ(registry.total().payload_bytes, 6 * sizeof(int));
+
+    vec.push_back(5);
+    EXPECT_EQ(registry.entries()[0].report.payload_bytes, 5 * sizeof(int));
+
+    std::ostringstream out;
+    registry.dump(out);
+    EXPECT_NE(out.str().find("list: payload"), std::string::npos);
+    EXPECT_NE(out.str().find("total: payload"), std::string::npos);
+  }
+  EXPECT_EQ(registry.entries().size(), 0);
+}
+
+TEST(Memory, RegistryHandleMove) {
+  auto &registry = s21::memory_registry::instance();
+  s21::vector<int> vec{1};
+  s21::memory_registry::registration outer;
+  {
+    auto inner = registry.track(vec, "moved");
+    outer = std::move(inner);
+  }
+  EXPECT_EQ(registry.entries().size(), 1);
+  outer.reset();
+  EXPECT_EQ(registry.entries().size(), 0);
+}
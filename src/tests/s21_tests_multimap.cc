@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+template <class It>
+std::vector<std::pair<int, int>> items_of(It first, It last) {
+  std::vector<std::pair<int, int>> items;
+  for (; first != last; ++first) items.emplace_back(first.key(), *first);
+  return items;
+}
+}  // namespace
+
+TEST(Multimap, InsertCountEqualRange) {
+  s21::multimap<int, int> map;
+  EXPECT_TRUE(map.empty());
+  map.insert(2, 20);
+  map.insert(1, 10);
+  map.insert(2, 21);
+  map.insert(3, 30);
+  auto it = map.insert(2, 22);
+  EXPECT_EQ(it.key(), 2);
+  EXPECT_EQ(*it, 22);
+
+  EXPECT_EQ(map.size(), 5U);
+  EXPECT_EQ(map.count(2), 3U);
+  EXPECT_EQ(map.count(1), 1U);
+  EXPECT_EQ(map.count(7), 0U);
+  EXPECT_TRUE(map.contains(3));
+
+  auto range = map.equal_range(2);
+  std::vector<int> values(range.first, range.second);
+  EXPECT_EQ(values, (std::vector<int>{20, 21, 22}));
+  EXPECT_EQ(*range.second, 30);
+  EXPECT_EQ(map.equal_range(7).first, map.end());
+  EXPECT_EQ(map.equal_range(7).second, map.end());
+  EXPECT_EQ(*map.find(3), 30);
+  EXPECT_EQ(map.find(4), map.end());
+}
+
+TEST(Multimap, OrderedIteration) {
+  s21::multimap<int, int> map{{5, 1}, {1, 2}, {5, 3}, {3, 4}, {1, 5}};
+  std::vector<std::pair<int, int>> expected{
+      {1, 2}, {1, 5}, {3, 4}, {5, 1}, {5, 3}};
+  EXPECT_EQ(items_of(map.begin(), map.end()), expected);
+
+  std::vector<std::pair<int, int>> backwards;
+  auto it = map.end();
+  while (it != map.begin()) {
+    --it;
+    backwards.emplace_back(it.key(), *it);
+  }
+  std::reverse(backwards.begin(), backwards.end());
+  EXPECT_EQ(backwards, expected);
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 5);
+}
+
+TEST(Multimap, EraseKeyValue) {
+  s21::multimap<int, int> map;
+  for (int i = 0; i < 10; ++i) map.insert(i % 2, i % 4);
+  EXPECT_EQ(map.count(0), 5U);
+  EXPECT_EQ(map.erase(0, 2), 2U);
+  EXPECT_EQ(map.erase(0, 7), 0U);
+  EXPECT_EQ(map.erase(4, 0), 0U);
+  auto range = map.equal_range(0);
+  EXPECT_EQ(std::vector<int>(range.first, range.second),
+            (std::vector<int>{0, 0, 0}));
+  EXPECT_EQ(map.size(), 8U);
+
+  EXPECT_EQ(map.erase(0, 0), 3U);
+  EXPECT_FALSE(map.contains(0));
+  EXPECT_EQ(map.size(), 5U);
+  EXPECT_EQ(map.erase(1), 5U);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.erase(1), 0U);
+}
+
+TEST(Multimap, EraseIterator) {
+  s21::multimap<int, int> map{{1, 1}, {2, 1}, {2, 2}, {2, 3}, {3, 1}};
+  auto it = map.erase(std::next(map.begin(), 2));
+  EXPECT_EQ(it.key(), 2);
+  EXPECT_EQ(*it, 3);
+  it = map.erase(it);
+  EXPECT_EQ(it.key(), 3);
+  it = map.erase(map.begin());
+  EXPECT_EQ(it, map.begin());
+  EXPECT_EQ(items_of(map.begin(), map.end()),
+            (std::vector<std::pair<int, int>>{{2, 1}, {3, 1}}));
+  EXPECT_EQ(map.size(), 2U);
+}
+
+TEST(Multimap, LargeBucketsAndStrings) {
+  s21::multimap<std::string, std::string> map;
+  for (int i = 0; i < 1000; ++i) {
+    map.insert("key" + std::to_string(i % 3), std::to_string(i));
+  }
+  EXPECT_EQ(map.count("key0"), 334U);
+  EXPECT_EQ(map.count("key1"), 333U);
+  auto range = map.equal_range("key1");
+  int expected = 1;
+  for (auto it = range.first; it != range.second; ++it, expected += 3) {
+    EXPECT_EQ(*it, std::to_string(expected));
+  }
+
+  s21::multimap<std::string, std::string> copy(map);
+  EXPECT_EQ(copy.size(), 1000U);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(copy.erase("key0", "999"), 1U);
+  EXPECT_EQ(copy.size(), 999U);
+  map = copy;
+  EXPECT_EQ(map.size(), 999U);
+  s21::multimap<std::string, std::string> moved(std::move(map));
+  EXPECT_EQ(moved.count("key2"), 333U);
+}
+
+TEST(Multimap, MatchesStdMultimap) {
+  std::mt19937 rng(17);
+  s21::multimap<int, int> map;
+  std::multimap<int, int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    int key = rng() % 300, value = rng() % 8;
+    if (rng() % 4) {
+      map.insert(key, value);
+      expected.emplace(key, value);
+    } else {
+      std::size_t removed = 0;
+      auto range = expected.equal_range(key);
+      for (auto it = range.first; it != range.second;) {
+        if (it->second == value) {
+          it = expected.erase(it);
+          ++removed;
+        } else {
+          ++it;
+        }
+      }
+      EXPECT_EQ(map.erase(key, value), removed);
+    }
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  std::vector<std::pair<int, int>> items(expected.begin(), expected.end());
+  EXPECT_EQ(items_of(map.begin(), map.end()), items);
+}
+
+TEST(Multimap, MemoryUsage) {
+  s21::multimap<int, int> map;
+  map.insert(1, 1);
+  map.insert(1, 2);
+  s21::memory_report inline_only = map.memory_usage();
+  EXPECT_EQ(inline_only.allocations, 2U);
+  EXPECT_EQ(inline_only.payload_bytes, sizeof(int) * 3);
+
+  map.insert(1, 3);
+  s21::memory_report spilled = map.memory_usage();
+  EXPECT_EQ(spilled.allocations, 3U);
+  EXPECT_EQ(spilled.payload_bytes, sizeof(int) * 4);
+  EXPECT_EQ(spilled.total_bytes(),
+            inline_only.total_bytes() + 4 * sizeof(int));
+}
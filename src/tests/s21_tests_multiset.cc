@@ -1,4 +1,6 @@
+#include <cstdio>
 #include <set>
+#include <string>
 
 #include "s21_test_class.h"
 #include "s21_tests.h"
@@ -982,7 +984,7 @@ TEST(Multiset_Modifier_int, InsertMany) {
   s21::vector<std::pair<s21::multiset<int>::iterator, bool>> result =
       cont_21.insert_many(1, 2, 3, 4, 5);
   s21::vector<std::pair<int, bool>> expect = {
-      {2, true}, {1, true}, {4, true}, {3, true}, {5, true}};
+      {1, true}, {2, true}, {3, true}, {4, true}, {5, true}};
 
   auto exp = expect.begin();
 
@@ -1028,4 +1030,28 @@ TEST(Multiset_Modifier_int, InsertManyWithRepeat) {
     EXPECT_EQ(elem.second, exp->second);
     ++exp;
   }
-}
\ No newline at end of file
+}
+TEST(Multiset_Snapshot_int, SaveLoad) {
+  const std::string path = testing::TempDir() + "s21_multiset_snapshot.bin";
+  s21::multiset<int> cont_21{5, 1, 5, 3, 5, 1};
+  cont_21.save(path);
+
+  auto loaded = s21::multiset<int>::load(path);
+
+  EXPECT_EQ(loaded.size(), 6);
+  EXPECT_EQ(loaded.count(5), 3);
+  EXPECT_EQ(loaded.count(1), 2);
+  EXPECT_EQ(loaded.count(3), 1);
+  EXPECT_THROW(s21::set<int>::load(path), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(Multiset_Stats_int, DuplicatesShareNodes) {
+  s21::multiset<int, std::less<int>, std::allocator<int>, s21::tree_stats>
+      cont_21;
+  for (int i = 0; i < 10; ++i) cont_21.insert(i % 3);
+
+  EXPECT_EQ(cont_21.size(), 10);
+  EXPECT_EQ(cont_21.stats().allocations, 3);
+  EXPECT_EQ(cont_21.height(), 2);
+}
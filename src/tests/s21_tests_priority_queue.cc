@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "s21_tests.h"
+
+TEST(PriorityQueueTest, DefaultConstructor) {
+  s21::priority_queue<int> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.size(), 0);
+}
+
+TEST(PriorityQueueTest, InitializerListConstructor) {
+  s21::priority_queue<int> queue{3, 9, 1, 7, 5};
+  EXPECT_EQ(queue.size(), 5);
+  EXPECT_EQ(queue.top(), 9);
+}
+
+TEST(PriorityQueueTest, PopsInOrder) {
+  s21::priority_queue<int> queue{4, 8, 15, 16, 23, 42, 8, 4};
+  std::vector<int> popped;
+  while (!queue.empty()) {
+    popped.push_back(queue.top());
+    queue.pop();
+  }
+  EXPECT_EQ(popped, (std::vector<int>{42, 23, 16, 15, 8, 8, 4, 4}));
+}
+
+TEST(PriorityQueueTest, MinHeapAndEmplace) {
+  s21::priority_queue<std::string, s21::vector<std::string>,
+                      std::greater<std::string>>
+      queue;
+  queue.emplace(3, 'c');
+  queue.push("aa");
+  queue.emplace("b");
+  EXPECT_EQ(queue.top(), "aa");
+  queue.pop();
+  EXPECT_EQ(queue.top(), "b");
+  queue.pop();
+  EXPECT_EQ(queue.top(), "ccc");
+}
+
+TEST(PriorityQueueTest, HeapifyRange) {
+  std::vector<int> values(1000);
+  std::mt19937 rng(5);
+  for (auto &value : values) value = rng() % 500;
+  s21::priority_queue<int> queue(values.begin(), values.end());
+
+  std::sort(values.rbegin(), values.rend());
+  for (int expected : values) {
+    ASSERT_EQ(queue.top(), expected);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(PriorityQueueTest, MatchesStdUnderChurn) {
+  std::mt19937 rng(9);
+  s21::priority_queue<int, std::vector<int>, std::less<int>, 3> queue;
+  std::priority_queue<int> reference;
+  for (int step = 0; step < 10000; ++step) {
+    if (rng() % 3 == 0 && !reference.empty()) {
+      ASSERT_EQ(queue.top(), reference.top());
+      queue.pop();
+      reference.pop();
+    } else {
+      int value = rng() % 1000;
+      queue.push(value);
+      reference.push(value);
+    }
+    ASSERT_EQ(queue.size(), reference.size());
+  }
+}
+
+TEST(PriorityQueueTest, MoveOnlyElements) {
+  struct by_value {
+    bool operator()(const std::unique_ptr<int> &lhs,
+                    const std::unique_ptr<int> &rhs) const {
+      return *lhs < *rhs;
+    }
+  };
+  s21::priority_queue<std::unique_ptr<int>,
+                      s21::vector<std::unique_ptr<int>>, by_value>
+      queue;
+  for (int i : {5, 1, 9, 3}) queue.push(std::make_unique<int>(i));
+  EXPECT_EQ(*queue.top(), 9);
+  queue.pop();
+  EXPECT_EQ(*queue.top(), 5);
+}
+
+TEST(PriorityQueueTest, CopyMoveSwap) {
+  s21::priority_queue<int> queue1{1, 2, 3};
+  s21::priority_queue<int> queue2(queue1);
+  EXPECT_EQ(queue2.top(), 3);
+
+  s21::priority_queue<int> queue3(std::move(queue1));
+  EXPECT_EQ(queue3.size(), 3);
+  EXPECT_TRUE(queue1.empty());
+
+  s21::priority_queue<int> queue4{10};
+  queue4.swap(queue3);
+  EXPECT_EQ(queue4.top(), 3);
+  EXPECT_EQ(queue3.top(), 10);
+
+  queue3.insert_many(20, 5);
+  EXPECT_EQ(queue3.top(), 20);
+  EXPECT_EQ(queue3.size(), 3);
+  EXPECT_EQ(queue3.memory_usage().payload_bytes, 3 * sizeof(int));
+}
@@ -0,0 +1,164 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+template <class It>
+std::vector<std::string> keys_of(It first, It last) {
+  std::vector<std::string> keys;
+  for (; first != last; ++first) keys.push_back(first.key());
+  return keys;
+}
+}  // namespace
+
+TEST(RadixMap, InsertFind) {
+  s21::radix_map<int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert("romane", 1).second);
+  EXPECT_TRUE(map.insert("romanus", 2).second);
+  EXPECT_TRUE(map.insert("romulus", 3).second);
+  EXPECT_TRUE(map.insert("rubens", 4).second);
+  EXPECT_TRUE(map.insert("rom", 5).second);
+  EXPECT_FALSE(map.insert("romane", 9).second);
+
+  EXPECT_EQ(map.size(), 5U);
+  EXPECT_EQ(map.at("romane"), 1);
+  EXPECT_EQ(map.at("rom"), 5);
+  EXPECT_EQ(*map.find("rubens"), 4);
+  EXPECT_EQ(map.find("rubens").key(), "rubens");
+  EXPECT_EQ(map.find("roman"), map.end());
+  EXPECT_EQ(map.find("r"), map.end());
+  EXPECT_EQ(map.find("romanes"), map.end());
+  EXPECT_FALSE(map.contains("ro"));
+  EXPECT_THROW(map.at("rome"), std::out_of_range);
+}
+
+TEST(RadixMap, AssignAndSubscript) {
+  s21::radix_map<int> map;
+  map["a/b"] = 1;
+  map["a"] += 2;
+  EXPECT_FALSE(map.insert_or_assign("a/b", 3).second);
+  EXPECT_TRUE(map.insert_or_assign("a/c", 4).second);
+  EXPECT_EQ(map.at("a"), 2);
+  EXPECT_EQ(map.at("a/b"), 3);
+  EXPECT_EQ(map.size(), 3U);
+}
+
+TEST(RadixMap, EmptyKey) {
+  s21::radix_map<int> map{{"", 1}, {"x", 2}};
+  EXPECT_EQ(map.at(""), 1);
+  EXPECT_EQ(map.begin().key(), "");
+  EXPECT_EQ(map.erase(""), 1U);
+  EXPECT_FALSE(map.contains(""));
+  EXPECT_EQ(map.begin().key(), "x");
+}
+
+TEST(RadixMap, OrderedIteration) {
+  s21::radix_map<int> map{{"b", 1}, {"abc", 2}, {"ab", 3},
+                          {"a", 4}, {"abd", 5}, {"\xff", 6}};
+  EXPECT_EQ(keys_of(map.begin(), map.end()),
+            (std::vector<std::string>{"a", "ab", "abc", "abd", "b", "\xff"}));
+  auto it = map.begin();
+  EXPECT_EQ(*it++, 4);
+  EXPECT_EQ(*it, 3);
+}
+
+TEST(RadixMap, LongestPrefixMatch) {
+  s21::radix_map<std::string> routes{{"/", "root"},
+                                     {"/api", "api"},
+                                     {"/api/v1/users", "users"},
+                                     {"/static/", "static"}};
+  EXPECT_EQ(*routes.longest_prefix_match("/api/v1/users/42"), "users");
+  EXPECT_EQ(routes.longest_prefix_match("/api/v1/users/42").key(),
+            "/api/v1/users");
+  EXPECT_EQ(*routes.longest_prefix_match("/api/v1/orders"), "api");
+  EXPECT_EQ(*routes.longest_prefix_match("/apix"), "api");
+  EXPECT_EQ(*routes.longest_prefix_match("/static"), "root");
+  EXPECT_EQ(routes.longest_prefix_match("static"), routes.end());
+}
+
+TEST(RadixMap, PrefixRange) {
+  s21::radix_map<int> map{{"cpu.user", 1}, {"cpu.system", 2}, {"cpu", 3},
+                          {"mem.free", 4}, {"mem.used", 5},   {"disk", 6}};
+  auto range = map.prefix_range("cpu.");
+  EXPECT_EQ(keys_of(range.first, range.second),
+            (std::vector<std::string>{"cpu.system", "cpu.user"}));
+  range = map.prefix_range("cpu");
+  EXPECT_EQ(keys_of(range.first, range.second),
+            (std::vector<std::string>{"cpu", "cpu.system", "cpu.user"}));
+  range = map.prefix_range("me");
+  EXPECT_EQ(keys_of(range.first, range.second),
+            (std::vector<std::string>{"mem.free", "mem.used"}));
+  range = map.prefix_range("mem.x");
+  EXPECT_EQ(range.first, range.second);
+  range = map.prefix_range("");
+  EXPECT_EQ(keys_of(range.first, range.second).size(), 6U);
+}
+
+TEST(RadixMap, EraseMergesNodes) {
+  s21::radix_map<int> map{{"test", 1}, {"team", 2}, {"toast", 3}};
+  auto before = map.memory_usage();
+  map.insert("te", 4);
+  EXPECT_EQ(map.erase("te"), 1U);
+  EXPECT_EQ(map.erase("te"), 0U);
+  EXPECT_EQ(map.erase("tea"), 0U);
+  EXPECT_EQ(map.memory_usage().total_bytes(), before.total_bytes());
+
+  EXPECT_EQ(map.erase("team"), 1U);
+  EXPECT_EQ(map.at("test"), 1);
+  EXPECT_EQ(map.erase("toast"), 1U);
+  EXPECT_EQ(keys_of(map.begin(), map.end()),
+            (std::vector<std::string>{"test"}));
+  EXPECT_EQ(map.memory_usage().allocations, 2U);
+  EXPECT_EQ(map.erase("test"), 1U);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(RadixMap, CopyMoveClear) {
+  s21::radix_map<int> map{{"alpha", 1}, {"alps", 2}};
+  s21::radix_map<int> copy(map);
+  copy["alpha"] = 10;
+  EXPECT_EQ(map.at("alpha"), 1);
+
+  s21::radix_map<int> moved(std::move(copy));
+  EXPECT_EQ(moved.at("alpha"), 10);
+  EXPECT_TRUE(copy.empty());
+
+  map = moved;
+  EXPECT_EQ(map.at("alpha"), 10);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  map.insert("alp", 3);
+  EXPECT_EQ(map.size(), 1U);
+}
+
+TEST(RadixMap, MatchesStdMap) {
+  std::mt19937 rng(7);
+  std::map<std::string, int> expected;
+  s21::radix_map<int> map;
+  for (int i = 0; i < 20000; ++i) {
+    std::string key;
+    int length = rng() % 6;
+    for (int j = 0; j < length; ++j) key += static_cast<char>('a' + rng() % 3);
+    if (rng() % 3) {
+      EXPECT_EQ(map.insert(key, i).second, expected.emplace(key, i).second);
+    } else {
+      EXPECT_EQ(map.erase(key), expected.erase(key));
+    }
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  auto it = map.begin();
+  for (const auto &item : expected) {
+    ASSERT_EQ(it.key(), item.first);
+    ASSERT_EQ(*it, item.second);
+    ++it;
+  }
+  EXPECT_EQ(it, map.end());
+}
@@ -1,4 +1,12 @@
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "s21_test_class.h"
 #include "s21_tests.h"
@@ -1118,7 +1126,7 @@ TEST(Set_Modifier_int, InsertMany) {
   s21::vector<std::pair<s21::set<int>::iterator, bool>> result =
       cont_21.insert_many(1, 2, 3, 4, 5);
   s21::vector<std::pair<int, bool>> expect = {
-      {2, true}, {1, true}, {4, true}, {3, true}, {5, true}};
+      {1, true}, {2, true}, {3, true}, {4, true}, {5, true}};
 
   auto exp = expect.begin();
 
@@ -1165,4 +1173,361 @@ TEST(Set_Modifier_int, InsertManyWithRepeat) {
     EXPECT_EQ(elem.second, exp->second);
     ++exp;
   }
-}
\ No newline at end of file
+}
+TEST(Set_Iterator_int, TraverseLargeTree) {
+  s21::set<int> cont_21;
+  std::set<int> cont_std;
+  for (int i = 0; i < 1000; ++i) {
+    int key = (i * 7919) % 1009;
+    cont_21.insert(key);
+    cont_std.insert(key);
+  }
+
+  EXPECT_TRUE(std::equal(cont_21.begin(), cont_21.end(), cont_std.begin(),
+                         cont_std.end()));
+  auto it_21 = cont_21.end();
+  for (auto it = cont_std.rbegin(); it != cont_std.rend(); ++it) {
+    EXPECT_EQ(*--it_21, *it);
+  }
+}
+
+TEST(Set_Modifier_int, EraseKeepsOrder) {
+  s21::set<int> cont_21;
+  std::set<int> cont_std;
+  for (int i = 0; i < 2000; ++i) {
+    int key = (i * 7919) % 1009;
+    if (i % 3 == 2) {
+      EXPECT_EQ(cont_21.erase(key), cont_std.erase(key));
+    } else {
+      cont_21.insert(key);
+      cont_std.insert(key);
+    }
+  }
+
+  EXPECT_EQ(cont_21.size(), cont_std.size());
+  EXPECT_TRUE(std::equal(cont_21.begin(), cont_21.end(), cont_std.begin(),
+                         cont_std.end()));
+  for (int key = 0; key < 1009; ++key) {
+    EXPECT_EQ(cont_21.contains(key), cont_std.count(key) == 1);
+  }
+}
+
+TEST(Set_Lookup_int, LowerUpperBound) {
+  s21::set<int> cont_21{10, 20, 30, 40};
+
+  EXPECT_EQ(*cont_21.lower_bound(5), 10);
+  EXPECT_EQ(*cont_21.lower_bound(20), 20);
+  EXPECT_EQ(*cont_21.upper_bound(20), 30);
+  EXPECT_EQ(*cont_21.lower_bound(31), 40);
+  EXPECT_EQ(cont_21.lower_bound(41), cont_21.end());
+  EXPECT_EQ(cont_21.upper_bound(40), cont_21.end());
+}
+
+TEST(Set_Freeze_int, Empty) {
+  s21::set<int> cont_21;
+  auto frozen = cont_21.freeze();
+
+  EXPECT_TRUE(frozen.empty());
+  EXPECT_EQ(frozen.begin(), frozen.end());
+  EXPECT_FALSE(frozen.contains(0));
+  EXPECT_EQ(frozen.lower_bound(0), frozen.end());
+}
+
+TEST(Set_Freeze_int, LookupMatchesSet) {
+  for (int size : {1, 2, 7, 15, 16, 31, 100, 255, 256, 1000}) {
+    s21::set<int> cont_21;
+    std::set<int> cont_std;
+    for (int i = 0; i < size; ++i) {
+      cont_21.insert(i * 3 - size);
+      cont_std.insert(i * 3 - size);
+    }
+    auto frozen = cont_21.freeze();
+
+    EXPECT_EQ(frozen.size(), cont_std.size());
+    for (int key = -size - 2; key < 2 * size + 2; ++key) {
+      EXPECT_EQ(frozen.contains(key), cont_std.count(key) == 1);
+      auto lower_std = cont_std.lower_bound(key);
+      auto lower_21 = frozen.lower_bound(key);
+      if (lower_std == cont_std.end()) {
+        EXPECT_EQ(lower_21, frozen.end());
+      } else {
+        EXPECT_EQ(*lower_21, *lower_std);
+      }
+      auto upper_std = cont_std.upper_bound(key);
+      auto upper_21 = frozen.upper_bound(key);
+      if (upper_std == cont_std.end()) {
+        EXPECT_EQ(upper_21, frozen.end());
+      } else {
+        EXPECT_EQ(*upper_21, *upper_std);
+      }
+    }
+  }
+}
+
+TEST(Set_Freeze_int, OrderedIteration) {
+  s21::set<int> cont_21{9, 3, 7, 1, 5, 2, 8, 6, 4, 0};
+  auto frozen = cont_21.freeze();
+
+  EXPECT_TRUE(std::equal(frozen.begin(), frozen.end(), cont_21.begin(),
+                         cont_21.end()));
+  int expected = 9;
+  for (auto it = frozen.end(); it != frozen.begin();) {
+    EXPECT_EQ(*--it, expected--);
+  }
+}
+
+TEST(Set_Freeze_CustomClass, Comparator) {
+  s21::set<TestUnit, TestUnitComparator> cont_21{
+      {"a", 1}, {"b", 2}, {"c", 3}, {"d", 4}};
+  auto frozen = cont_21.freeze();
+
+  EXPECT_EQ(frozen.begin()->name, "d");
+  EXPECT_TRUE(frozen.contains({"b", 2}));
+  EXPECT_FALSE(frozen.contains({"b", 3}));
+  EXPECT_EQ(frozen.find({"c", 3})->name, "c");
+  EXPECT_EQ(frozen.find({"e", 5}), frozen.end());
+}
+
+TEST(Set_Lookup_int, FindMany) {
+  s21::set<int> cont_21{1, 3, 5, 7, 9};
+  int keys[] = {0, 1, 2, 3, 9, 10};
+  std::vector<s21::set<int>::iterator> found;
+
+  cont_21.find_many(keys, keys + 6, std::back_inserter(found));
+
+  ASSERT_EQ(found.size(), 6);
+  EXPECT_EQ(found[0], cont_21.end());
+  EXPECT_EQ(*found[1], 1);
+  EXPECT_EQ(found[2], cont_21.end());
+  EXPECT_EQ(*found[3], 3);
+  EXPECT_EQ(*found[4], 9);
+  EXPECT_EQ(found[5], cont_21.end());
+}
+
+TEST(Set_Snapshot_int, SaveLoadOpen) {
+  const std::string path = testing::TempDir() + "s21_set_snapshot.bin";
+  s21::set<int> cont_21;
+  for (int i = 0; i < 100; ++i) cont_21.insert(i * 3);
+  cont_21.save(path);
+
+  auto loaded = s21::set<int>::load(path);
+  auto mapped = s21::eytzinger_set<int>::open(path);
+
+  EXPECT_EQ(loaded.size(), 100);
+  EXPECT_TRUE(std::equal(loaded.begin(), loaded.end(), cont_21.begin(),
+                         cont_21.end()));
+  EXPECT_TRUE(std::equal(mapped.begin(), mapped.end(), cont_21.begin(),
+                         cont_21.end()));
+  EXPECT_TRUE(mapped.contains(297));
+  EXPECT_FALSE(mapped.contains(298));
+  std::remove(path.c_str());
+}
+
+TEST(Set_Snapshot_int, SaveBesideStaleTemporary) {
+  const std::string path = testing::TempDir() + "s21_set_snapshot_tmp.bin";
+  const std::string stale = path + ".tmp";
+  ASSERT_EQ(::mkdir(stale.c_str(), 0700), 0);
+  s21::set<int> cont_21{5, 1, 3};
+  EXPECT_NO_THROW(cont_21.save(path));
+  EXPECT_NO_THROW(cont_21.save(path));
+
+  struct stat info;
+  ASSERT_EQ(::stat(path.c_str(), &info), 0);
+  EXPECT_EQ(info.st_mode & 0777, 0644u);
+  auto loaded = s21::set<int>::load(path);
+  EXPECT_TRUE(std::equal(loaded.begin(), loaded.end(), cont_21.begin(),
+                         cont_21.end()));
+  EXPECT_THROW(cont_21.save(testing::TempDir() + "s21_missing_dir/set.bin"),
+               std::runtime_error);
+  std::remove(path.c_str());
+  ::rmdir(stale.c_str());
+}
+
+TEST(Set_Stats_int, SequentialInsert) {
+  s21::set<int, std::less<int>, std::allocator<int>, s21::tree_stats> cont_21;
+  for (int i = 0; i < 1023; ++i) cont_21.insert(i);
+
+  const auto &stats = cont_21.stats();
+  EXPECT_EQ(cont_21.height(), 10);
+  EXPECT_EQ(stats.allocations, 1023);
+  EXPECT_EQ(stats.frees, 0);
+  EXPECT_GT(stats.single_rotations, 0);
+  EXPECT_EQ(stats.double_rotations, 0);
+  EXPECT_GT(stats.comparisons, 1023);
+  EXPECT_LE(stats.max_depth, 10);
+}
+
+TEST(Set_Stats_int, LookupDepth) {
+  s21::set<int, std::less<int>, std::allocator<int>, s21::tree_stats> cont_21{
+      2, 1, 3};
+  cont_21.stats().reset();
+
+  cont_21.find(2);
+  cont_21.find(3);
+  cont_21.find(4);
+
+  const auto &stats = cont_21.stats();
+  EXPECT_EQ(stats.descents, 3);
+  EXPECT_EQ(stats.max_depth, 2);
+  EXPECT_DOUBLE_EQ(stats.average_depth(), 1.0);
+  EXPECT_EQ(stats.allocations, 0);
+}
+
+TEST(Set_Stats_int, DoubleRotation) {
+  s21::set<int, std::less<int>, std::allocator<int>, s21::tree_stats> cont_21{
+      1, 3, 2};
+  EXPECT_EQ(cont_21.stats().double_rotations, 1);
+  EXPECT_EQ(cont_21.stats().single_rotations, 0);
+  EXPECT_EQ(cont_21.height(), 2);
+
+  cont_21.erase(2);
+  cont_21.erase(1);
+  EXPECT_EQ(cont_21.stats().frees, 2);
+  EXPECT_EQ(cont_21.height(), 1);
+}
+
+TEST(Set_Stats_int, ClearCountsEveryFree) {
+  s21::set<int, std::less<int>, std::allocator<int>, s21::tree_stats> cont_21;
+  for (int i = 0; i < 100; ++i) cont_21.insert(i);
+  cont_21.erase(7);
+  cont_21.clear();
+  EXPECT_EQ(cont_21.stats().frees, 100);
+  cont_21.insert(1);
+  cont_21.clear();
+  EXPECT_EQ(cont_21.stats().frees, 101);
+  EXPECT_EQ(cont_21.stats().allocations, 101);
+}
+
+TEST(Set_Stats_int, DisabledAddsNoState) {
+  EXPECT_EQ(sizeof(s21::set<int>),
+            (sizeof(s21::set<int, std::less<int>, std::allocator<int>,
+                                 s21::tree_stats>) -
+             sizeof(s21::tree_stats)));
+  EXPECT_EQ(s21::set<int>{}.height(), 0);
+}
+
+TEST(Set_Clear_int, Async) {
+  s21::set<int> cont_21;
+  for (int i = 0; i < 10000; ++i) cont_21.insert(i);
+  auto done = cont_21.clear_async();
+
+  EXPECT_TRUE(cont_21.empty());
+  EXPECT_EQ(cont_21.begin(), cont_21.end());
+  EXPECT_EQ(cont_21.memory_usage().allocations, 1);
+  cont_21.insert(5);
+  EXPECT_TRUE(cont_21.contains(5));
+  done.get();
+}
+
+TEST(Set_Clear_int, ArenaAllocator) {
+  s21::set<int, std::less<int>, s21::arena_allocator<int>> cont_21;
+  for (int i = 0; i < 10000; ++i) cont_21.insert(i);
+  cont_21.clear();
+
+  EXPECT_TRUE(cont_21.empty());
+  cont_21.insert(7);
+  EXPECT_EQ(*cont_21.begin(), 7);
+  cont_21.clear_async().get();
+  EXPECT_TRUE(cont_21.empty());
+}
+
+TEST(Set_Clear_int, ClearKeepsSuppliedArena) {
+  auto pool = std::make_shared<s21::arena>(4096);
+  s21::set<int, std::less<int>, s21::arena_allocator<int>> cont_21{
+      s21::arena_allocator<int>(pool)};
+  for (int i = 0; i < 1000; ++i) cont_21.insert(i);
+  cont_21.clear();
+
+  EXPECT_EQ(cont_21.get_allocator().resource(), pool);
+  std::size_t reserved = pool->reserved();
+  for (int i = 0; i < 1000; ++i) cont_21.insert(i);
+  EXPECT_GT(pool->reserved(), reserved);
+  cont_21.clear_async().get();
+  EXPECT_EQ(cont_21.get_allocator().resource(), pool);
+
+  s21::set<int, std::less<int>, s21::arena_allocator<int>> cont_22;
+  cont_22.insert(1);
+  auto own = cont_22.get_allocator().resource();
+  cont_22.clear();
+  EXPECT_TRUE(cont_22.get_allocator().owns_arena());
+  EXPECT_NE(cont_22.get_allocator().resource(), own);
+}
+
+TEST(Set_Clear_int, ClearAfterSwappingArenaSets) {
+  s21::set<int, std::less<int>, s21::arena_allocator<int>> cont_21;
+  s21::set<int, std::less<int>, s21::arena_allocator<int>> cont_22;
+  for (int i = 0; i < 1000; ++i) {
+    cont_21.insert(i);
+    cont_22.insert(-i);
+  }
+  cont_21.swap(cont_22);
+  cont_21.clear();
+
+  int expected = 0;
+  for (int item : cont_22) EXPECT_EQ(item, expected++);
+  EXPECT_EQ(expected, 1000);
+}
+
+TEST(Set_Hint_int, AppendNeedsNoDescent) {
+  s21::set<int, std::less<int>, std::allocator<int>, s21::tree_stats> cont_21;
+  for (int i = 0; i < 1023; ++i) cont_21.insert(i);
+
+  const auto &stats = cont_21.stats();
+  EXPECT_EQ(stats.max_depth, 0);
+  EXPECT_LE(stats.comparisons, 3 * 1023);
+  EXPECT_EQ(cont_21.height(), 10);
+
+  cont_21.erase(1022);
+  cont_21.erase(1021);
+  cont_21.stats().reset();
+  EXPECT_FALSE(cont_21.insert(1020).second);
+  EXPECT_TRUE(cont_21.insert(1021).second);
+  EXPECT_EQ(*std::prev(cont_21.end()), 1021);
+  EXPECT_EQ(stats.max_depth, 0);
+}
+
+TEST(Set_Hint_int, HintedInsert) {
+  s21::set<int, std::less<int>, std::allocator<int>, s21::tree_stats> cont_21;
+  for (int i = 0; i < 200; i += 2) cont_21.insert(i);
+  std::vector<decltype(cont_21)::iterator> hints;
+  for (int i = 2; i <= 200; i += 2) hints.push_back(cont_21.find(i));
+  cont_21.stats().reset();
+  for (int i = 1; i < 200; i += 2) {
+    auto it = cont_21.insert(hints[i / 2], i);
+    EXPECT_EQ(*it, i);
+  }
+  EXPECT_EQ(cont_21.stats().max_depth, 0);
+  EXPECT_LE(cont_21.stats().comparisons, 5 * 100);
+
+  auto hint = cont_21.begin();
+  EXPECT_EQ(*cont_21.insert(hint, 150), 150);
+  EXPECT_EQ(*cont_21.insert(cont_21.end(), -5), -5);
+  EXPECT_EQ(*cont_21.insert(cont_21.find(10), 500), 500);
+  EXPECT_EQ(cont_21.size(), 202);
+  std::vector<int> expected{-5};
+  for (int i = 0; i < 200; ++i) expected.push_back(i);
+  expected.push_back(500);
+  EXPECT_TRUE(std::equal(cont_21.begin(), cont_21.end(), expected.begin(),
+                         expected.end()));
+}
+
+TEST(Set_Hint_int, MatchesStdSet) {
+  s21::set<int> cont_21;
+  std::set<int> cont_orig;
+  unsigned state = 7;
+  for (int i = 0; i < 20000; ++i) {
+    state = state * 1103515245 + 12345;
+    int key = i / 4 + static_cast<int>(state >> 16) % 8;
+    if (state % 5 == 0) {
+      EXPECT_EQ(cont_21.erase(key), cont_orig.erase(key));
+    } else if (state % 5 == 1) {
+      cont_21.insert(cont_21.find(key + 1), key);
+      cont_orig.insert(key);
+    } else {
+      EXPECT_EQ(cont_21.insert(key).second, cont_orig.insert(key).second);
+    }
+  }
+  EXPECT_EQ(cont_21.size(), cont_orig.size());
+  EXPECT_TRUE(std::equal(cont_21.begin(), cont_21.end(), cont_orig.begin(),
+                         cont_orig.end()));
+}
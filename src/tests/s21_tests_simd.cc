@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+
+#include "s21_tests.h"
+
+namespace {
+using s21::simd::isa;
+
+// Runs check once per instruction set the CPU supports, then restores it
+template <typename Check>
+void for_each_isa(Check check) {
+  for (isa level : {isa::scalar, isa::sse2, isa::avx2}) {
+    if (level > s21::simd::supported_isa()) continue;
+    s21::simd::set_isa(level);
+    SCOPED_TRACE(static_cast<int>(level));
+    check();
+  }
+  s21::simd::set_isa(s21::simd::supported_isa());
+}
+
+// Sizes around every vector width, so each kernel runs its tail loop
+constexpr std::size_t kSizes[] = {0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33,
+                                  63, 64, 65, 100, 257, 1000};
+
+template <typename T>
+s21::vector<T> random_values(std::size_t n, int low, int high) {
+  std::mt19937 rng(static_cast<unsigned>(n));
+  std::uniform_int_distribution<int> value(low, high);
+  s21::vector<T> result;
+  for (std::size_t i = 0; i < n; ++i) {
+    result.push_back(static_cast<T>(value(rng)));
+  }
+  return result;
+}
+
+template <typename T>
+s21::vector<T> filled(std::size_t n, T value) {
+  s21::vector<T> result(n);
+  std::fill(result.begin(), result.end(), value);
+  return result;
+}
+
+template <typename T>
+void check_matches_std(int low, int high) {
+  for (std::size_t n : kSizes) {
+    SCOPED_TRACE(n);
+    s21::vector<T> v = random_values<T>(n, low, high);
+    const T *first = v.data();
+    const T *last = v.data() + n;
+    for (int needle = low; needle <= high; ++needle) {
+      T value = static_cast<T>(needle);
+      EXPECT_EQ(s21::simd::find(v, value), std::find(first, last, value));
+      EXPECT_EQ(s21::simd::count(v, value), std::count(first, last, value));
+    }
+    EXPECT_EQ(s21::simd::min_element(v), std::min_element(first, last));
+    EXPECT_EQ(s21::simd::max_element(v), std::max_element(first, last));
+    s21::vector<T> copy(v);
+    EXPECT_TRUE(s21::simd::equal(v, copy));
+    if (n) {
+      copy[n - 1] = static_cast<T>(copy[n - 1] + 1);
+      EXPECT_FALSE(s21::simd::equal(v, copy));
+      copy.pop_back();
+      EXPECT_FALSE(s21::simd::equal(v, copy));
+    }
+    s21::simd::fill(copy, static_cast<T>(high));
+    EXPECT_EQ(std::count(copy.begin(), copy.end(), static_cast<T>(high)),
+              static_cast<std::ptrdiff_t>(copy.size()));
+  }
+}
+}  // namespace
+
+TEST(Simd, KernelsMatchStdAlgorithms) {
+  for_each_isa([] {
+    check_matches_std<std::int32_t>(-50, 50);
+    check_matches_std<std::uint32_t>(0, 40);
+    check_matches_std<std::uint8_t>(0, 255);
+    check_matches_std<std::int8_t>(-128, 127);
+    check_matches_std<char>(0, 100);
+    check_matches_std<float>(-20, 20);
+    check_matches_std<double>(-20, 20);
+  });
+}
+
+TEST(Simd, MinAndMaxReturnFirstOccurrence) {
+  for_each_isa([] {
+    s21::vector<std::int32_t> ints(100);
+    ints[3] = ints[70] = std::numeric_limits<std::int32_t>::min();
+    ints[5] = ints[90] = std::numeric_limits<std::int32_t>::max();
+    EXPECT_EQ(s21::simd::min_element(ints), ints.data() + 3);
+    EXPECT_EQ(s21::simd::max_element(ints), ints.data() + 5);
+
+    s21::vector<float> zeros = filled(40, 1.0f);
+    zeros[9] = 0.0f;
+    zeros[30] = -0.0f;
+    EXPECT_EQ(s21::simd::min_element(zeros), zeros.data() + 9);
+    s21::vector<float> empty;
+    EXPECT_EQ(s21::simd::min_element(empty), empty.data());
+  });
+}
+
+TEST(Simd, FloatNaNFollowsStd) {
+  for_each_isa([] {
+    for (std::size_t at : {0, 5, 20, 39}) {
+      s21::vector<float> v = random_values<float>(40, -9, 9);
+      v[at] = std::numeric_limits<float>::quiet_NaN();
+      EXPECT_EQ(s21::simd::min_element(v),
+                std::min_element(v.begin(), v.end()));
+      EXPECT_EQ(s21::simd::max_element(v),
+                std::max_element(v.begin(), v.end()));
+      EXPECT_EQ(s21::simd::find(v, v[at]), v.end());
+      EXPECT_EQ(s21::simd::count(v, v[at]), 0);
+      EXPECT_FALSE(s21::simd::equal(v, v));
+    }
+    s21::vector<float> signed_zeros = filled(20, 0.0f);
+    s21::vector<float> zeros = filled(20, -0.0f);
+    EXPECT_TRUE(s21::simd::equal(signed_zeros, zeros));
+    EXPECT_EQ(s21::simd::count(zeros, 0.0f), 20);
+  });
+}
+
+TEST(Simd, CountsBeyondLaneCounterRange) {
+  for_each_isa([] {
+    s21::vector<std::uint8_t> bytes = filled<std::uint8_t>(100003, 7);
+    bytes[50000] = 8;
+    EXPECT_EQ(s21::simd::count(bytes, 7), 100002);
+    EXPECT_EQ(s21::simd::find(bytes, 8), bytes.data() + 50000);
+  });
+}
+
+TEST(Simd, AccumulateWidensIntegers) {
+  for_each_isa([] {
+    s21::vector<std::uint8_t> bytes = filled<std::uint8_t>(100001, 255);
+    EXPECT_EQ(s21::simd::accumulate(bytes, std::uint64_t(1)),
+              100001ull * 255 + 1);
+    s21::vector<std::int32_t> ints =
+        filled(1001, std::numeric_limits<std::int32_t>::max());
+    ints[0] = -5;
+    std::int64_t exact = 1000ll * std::numeric_limits<int>::max() - 5;
+    EXPECT_EQ(s21::simd::accumulate(ints, std::int64_t(0)), exact);
+    EXPECT_EQ(s21::simd::accumulate(ints, 0), static_cast<int>(exact));
+    for (std::size_t n : kSizes) {
+      s21::vector<std::int32_t> v = random_values<std::int32_t>(n, -99, 99);
+      EXPECT_EQ(s21::simd::accumulate(v, 10),
+                std::accumulate(v.begin(), v.end(), 10));
+      s21::vector<float> f = random_values<float>(n, -99, 99);
+      EXPECT_EQ(s21::simd::accumulate(f, 0.5f),  // exact in float
+                std::accumulate(f.begin(), f.end(), 0.5f));
+    }
+    s21::vector<double> doubles{0.5, 1.5};
+    EXPECT_EQ(s21::simd::accumulate(doubles, 1.0), 3.0);
+  });
+}
+
+TEST(Simd, AccumulateFloatsIntoWiderInit) {
+  for_each_isa([] {
+    // 2^24 + 1.0f rounds back to 2^24 in float but not in double
+    s21::vector<float> f = filled(1001, 1.0f);
+    f[0] = 16777216.0f;
+    EXPECT_EQ(s21::simd::accumulate(f, 0.0), 16778216.0);
+    EXPECT_EQ(s21::simd::accumulate(f, 0.0),
+              std::accumulate(f.begin(), f.end(), 0.0));
+  });
+}
+
+TEST(Simd, WorksOnArraysAndPointerRanges) {
+  for_each_isa([] {
+    s21::array<float, 13> a{};
+    s21::simd::fill(a, 2.5f);
+    a[11] = -1.0f;
+    EXPECT_EQ(s21::simd::find(a, -1.0f), a.data() + 11);
+    EXPECT_EQ(s21::simd::min_element(a), a.data() + 11);
+    EXPECT_EQ(s21::simd::accumulate(a, 0.0f), 29.0f);
+    const s21::array<float, 13> &constant = a;
+    EXPECT_EQ(*s21::simd::max_element(constant), 2.5f);
+
+    s21::small_vector<std::int32_t, 8> small{4, 1, 4};
+    s21::static_vector<std::int32_t, 8> fixed{4, 1, 4};
+    EXPECT_TRUE(s21::simd::equal(small, fixed));
+    EXPECT_EQ(s21::simd::count(fixed, 4), 2);
+
+    std::string text = "contiguous bytes";
+    EXPECT_EQ(s21::simd::find(text.data(), text.data() + text.size(), 'b'),
+              text.data() + 11);
+  });
+}
@@ -0,0 +1,117 @@
+#include <memory>
+#include <string>
+
+#include "s21_tests.h"
+
+namespace {
+// Counts live objects and move constructions
+struct counted {
+  static inline int live = 0;
+  static inline int moves = 0;
+  int value;
+
+  counted(int v = 0) : value(v) { ++live; }
+  counted(const counted &other) : value(other.value) { ++live; }
+  counted(counted &&other) noexcept : value(other.value) {
+    ++live;
+    ++moves;
+  }
+  counted &operator=(const counted &) = default;
+  ~counted() { --live; }
+};
+}  // namespace
+
+TEST(SmallVector, StaysInlineUpToN) {
+  s21::small_vector<int, 4> v;
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4);
+  for (int i = 0; i < 4; ++i) v.push_back(i);
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.memory_usage().allocations, 0);
+  v.push_back(4);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 8);
+  EXPECT_EQ(v.memory_usage().allocations, 1);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i);
+
+  v.erase(v.begin() + 1, v.begin() + 3);
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[1], 3);
+  EXPECT_EQ(v.back(), 4);
+}
+
+TEST(SmallVector, VectorInterface) {
+  s21::small_vector<std::string, 2> v{"b", "d"};
+  v.insert(v.begin(), "a");
+  v.insert(v.begin() + 2, 2, "c");
+  v.emplace(v.end(), 2, 'e');
+  v.insert_many(v.begin() + 1, v[0], "x");
+  v.insert_many_back("f", "g");
+  const char *expected[] = {"a", "a", "x", "b", "c", "c", "d", "ee", "f", "g"};
+  ASSERT_EQ(v.size(), 10);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(v.at(i), expected[i]);
+  EXPECT_THROW(v.at(10), std::out_of_range);
+  v.erase(v.begin());
+  v.pop_back();
+  v.resize(3);
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v.front(), "a");
+  v.resize(5);
+  EXPECT_EQ(v[4], "");
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(SmallVector, MovesRelocateInlineAndStealHeap) {
+  counted::live = 0;
+  {
+    s21::small_vector<counted, 8> inline_v;
+    for (int i = 0; i < 3; ++i) inline_v.emplace_back(i);
+    s21::small_vector<counted, 8> heap_v;
+    for (int i = 0; i < 20; ++i) heap_v.emplace_back(i);
+
+    counted::moves = 0;
+    s21::small_vector<counted, 8> moved_heap(std::move(heap_v));
+    EXPECT_EQ(counted::moves, 0);
+    EXPECT_TRUE(heap_v.empty());
+    EXPECT_TRUE(heap_v.is_inline());
+    EXPECT_EQ(moved_heap[19].value, 19);
+
+    s21::small_vector<counted, 8> moved_inline(std::move(inline_v));
+    EXPECT_EQ(counted::moves, 3);
+    EXPECT_TRUE(moved_inline.is_inline());
+    EXPECT_EQ(moved_inline[2].value, 2);
+
+    moved_inline.swap(moved_heap);
+    EXPECT_EQ(moved_inline.size(), 20);
+    EXPECT_EQ(moved_heap.size(), 3);
+    EXPECT_EQ(moved_heap[1].value, 1);
+
+    s21::small_vector<counted, 8> other_heap(moved_inline);
+    counted::moves = 0;
+    other_heap.swap(moved_inline);
+    EXPECT_EQ(counted::moves, 0);
+
+    moved_heap = moved_inline;
+    EXPECT_EQ(moved_heap.size(), 20);
+    moved_inline = std::move(moved_heap);
+    EXPECT_TRUE(moved_heap.empty());
+    EXPECT_EQ(counted::live, 40);
+  }
+  EXPECT_EQ(counted::live, 0);
+}
+
+TEST(SmallVector, MoveOnlyElementsAndGrowthPolicy) {
+  s21::small_vector<std::unique_ptr<int>, 2, s21::one_and_half_growth> v;
+  for (int i = 0; i < 10; ++i) v.push_back(std::make_unique<int>(i));
+  EXPECT_EQ(v.capacity(), 13);
+  EXPECT_EQ(*v[9], 9);
+  s21::small_vector<int, 3> ints(5);
+  ints.insert(ints.begin(), ints.begin() + 1, ints.begin() + 1);
+  ints.reserve(100);
+  ints.shrink_to_fit();
+  EXPECT_EQ(ints.capacity(), 5);
+  EXPECT_EQ(ints.size(), 5);
+}
@@ -137,3 +137,12 @@ TEST(StackTest, InsertManyBackExistingElements) {
   stack.pop();
   EXPECT_EQ(stack.top(), 1);
 }
+
+TEST(StackTest, AllocatorReachesContainer) {
+  auto pool = std::make_shared<s21::arena>();
+  s21::stack<int, s21::arena_allocator<int>> stack{
+      s21::arena_allocator<int>(pool)};
+  for (int i = 0; i < 100; ++i) stack.push(i);
+  EXPECT_EQ(stack.top(), 99);
+  EXPECT_GE(pool->reserved(), 100 * sizeof(int));
+}
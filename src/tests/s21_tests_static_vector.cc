@@ -0,0 +1,160 @@
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "s21_tests.h"
+
+namespace {
+struct point {
+  int x, y;
+};
+
+constexpr s21::static_vector<int, 8> squares(int n) {
+  s21::static_vector<int, 8> result;
+  for (int i = 0; i < n; ++i) result.push_back(i * i);
+  return result;
+}
+
+constexpr int edited_sum() {
+  s21::static_vector<int, 16> v{5, 6, 7};
+  v.insert(v.begin(), 2, 1);
+  v.insert_many(v.begin() + 1, v[4], 9);
+  v.emplace(v.end(), v[0]);
+  v.erase(v.begin() + 2);
+  v.resize(v.size() + 1);
+  v.pop_back();
+  int sum = 0;
+  for (int item : v) sum += item;
+  return sum * 100 + static_cast<int>(v.size());
+}
+
+constexpr s21::static_vector<point, 4> kCorners = [] {
+  s21::static_vector<point, 4> corners;
+  corners.emplace_back(0, 0);
+  corners.emplace_back(0, 1);
+  corners.emplace(corners.begin() + 1, 1, 0);
+  return corners;
+}();
+
+static_assert(squares(5).size() == 5 && squares(5)[4] == 16);
+static_assert(squares(8).full());
+// {1, 7, 1, 5, 6, 7, 1}: 28 over 7 elements
+static_assert(edited_sum() == 2807);
+static_assert(kCorners.size() == 3 && kCorners[1].x == 1);
+static_assert(std::is_trivially_destructible<s21::static_vector<int, 4>>());
+static_assert(!std::is_trivially_destructible<
+              s21::static_vector<std::string, 4>>());
+
+// Counts live objects; copying throws once copies_left runs out
+struct counted {
+  static inline int live = 0;
+  static inline int copies_left = -1;
+  int value;
+
+  counted(int v = 0) : value(v) { ++live; }
+  counted(const counted &other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy failed");
+    if (copies_left > 0) --copies_left;
+    ++live;
+  }
+  counted(counted &&other) noexcept : value(other.value) { ++live; }
+  counted &operator=(const counted &) = default;
+  ~counted() { --live; }
+};
+}  // namespace
+
+TEST(StaticVector, CapacityIsChecked) {
+  s21::static_vector<int, 4> v{1, 2, 3};
+  v.push_back(4);
+  EXPECT_TRUE(v.full());
+  EXPECT_THROW(v.push_back(5), std::length_error);
+  EXPECT_THROW(v.insert(v.begin(), 0), std::length_error);
+  EXPECT_THROW(v.resize(5), std::length_error);
+  EXPECT_THROW(v.reserve(5), std::length_error);
+  ASSERT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], 1);
+  EXPECT_EQ(v.back(), 4);
+  EXPECT_THROW(v.at(4), std::out_of_range);
+  EXPECT_EQ(v.memory_usage().allocations, 0);
+  EXPECT_EQ(v.capacity(), 4);
+}
+
+TEST(StaticVector, NonTrivialElements) {
+  s21::static_vector<std::string, 8> v{"b", "d"};
+  v.insert(v.begin(), "a");
+  v.insert(v.begin() + 2, 2, v[1]);
+  v.emplace(v.end(), 2, 'e');
+  v.insert_many(v.begin() + 1, v[0], "x");
+  const char *expected[] = {"a", "a", "x", "b", "b", "b", "d", "ee"};
+  ASSERT_EQ(v.size(), 8);
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(v[i], expected[i]);
+  EXPECT_THROW(v.emplace_back("f"), std::length_error);
+
+  EXPECT_EQ(v.erase(v.begin() + 3, v.begin() + 6), v.begin() + 3);
+  EXPECT_EQ(v[3], "d");
+  s21::static_vector<std::string, 8> copy(v);
+  s21::static_vector<std::string, 8> moved(std::move(v));
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(moved.size(), 5);
+  copy.resize(1);
+  copy.swap(moved);
+  EXPECT_EQ(copy.size(), 5);
+  EXPECT_EQ(moved.front(), "a");
+
+  std::istringstream in("y z");
+  moved.insert(moved.begin(), std::istream_iterator<std::string>(in),
+               std::istream_iterator<std::string>());
+  EXPECT_EQ(moved[0], "y");
+  EXPECT_EQ(moved[2], "a");
+}
+
+TEST(StaticVector, FailuresLeaveElementsIntact) {
+  counted::live = 0;
+  {
+    s21::static_vector<counted, 10> v;
+    for (int i = 0; i < 5; ++i) v.emplace_back(i);
+    const counted value(-1);
+    counted::copies_left = 1;
+    EXPECT_THROW(v.insert(v.begin() + 1, 3, value), std::runtime_error);
+    counted::copies_left = -1;
+    ASSERT_EQ(v.size(), 5);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i].value, i);
+    EXPECT_THROW(v.insert(v.begin(), 6, value), std::length_error);
+    EXPECT_EQ(counted::live, 6);
+    v.insert_many_back(counted(5));
+    EXPECT_EQ(counted::live, 7);
+  }
+  EXPECT_EQ(counted::live, 0);
+}
+
+TEST(StaticVector, OverflowFromInputRangeLeavesElementsIntact) {
+  s21::static_vector<std::string, 4> words{"a", "b"};
+  std::istringstream three("x y z");
+  EXPECT_THROW(words.insert(words.begin() + 1,
+                            std::istream_iterator<std::string>(three),
+                            std::istream_iterator<std::string>()),
+               std::length_error);
+  ASSERT_EQ(words.size(), 2);
+  EXPECT_EQ(words[0], "a");
+  EXPECT_EQ(words[1], "b");
+
+  s21::static_vector<int, 4> ints{1, 2, 3};
+  std::istringstream two("8 9");
+  EXPECT_THROW(ints.insert(ints.begin(), std::istream_iterator<int>(two),
+                           std::istream_iterator<int>()),
+               std::length_error);
+  ASSERT_EQ(ints.size(), 3);
+  EXPECT_EQ(ints[0], 1);
+  EXPECT_EQ(ints[2], 3);
+}
+
+TEST(StaticVector, MoveOnlyElements) {
+  s21::static_vector<std::unique_ptr<int>, 3> v;
+  v.push_back(std::make_unique<int>(2));
+  v.insert(v.begin(), std::make_unique<int>(1));
+  EXPECT_EQ(*v.emplace_back(new int(3)), 3);
+  EXPECT_EQ(*v[0], 1);
+  EXPECT_EQ(*v[1], 2);
+}
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+template <class Balance>
+using balanced_set = s21::set<int, std::less<int>, std::allocator<int>,
+                              s21::tree_stats_disabled, Balance>;
+
+template <class Balance>
+using balanced_map =
+    s21::map<int, std::string, std::less<int>,
+             std::allocator<std::pair<const int, std::string>>,
+             s21::tree_stats_disabled, Balance>;
+
+template <class Balance>
+using balanced_multiset = s21::multiset<int, std::less<int>,
+                                        std::allocator<int>,
+                                        s21::tree_stats_disabled, Balance>;
+
+// Worst-case height of each policy for n elements
+double height_bound(s21::avl_balance, std::size_t n) {
+  return 1.45 * std::log2(n + 2.0);
+}
+
+double height_bound(s21::red_black_balance, std::size_t n) {
+  return 2 * std::log2(n + 1.0);
+}
+
+double height_bound(s21::weight_balance, std::size_t n) {
+  return std::log(n + 1.0) / std::log(4.0 / 3.0) + 1;
+}
+
+template <class Balance>
+class TreeBalance : public ::testing::Test {};
+
+using Policies = ::testing::Types<s21::avl_balance, s21::red_black_balance,
+                                  s21::weight_balance>;
+TYPED_TEST_SUITE(TreeBalance, Policies);
+}  // namespace
+
+TYPED_TEST(TreeBalance, SetMatchesStdSet) {
+  std::mt19937 rng(11);
+  balanced_set<TypeParam> set;
+  std::set<int> expected;
+  for (int i = 0; i < 50000; ++i) {
+    int key = rng() % 4000;
+    if (rng() % 3) {
+      EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+    } else {
+      EXPECT_EQ(set.erase(key), expected.erase(key));
+    }
+    if (i % 5000 == 0) {
+      EXPECT_LE(set.height(), height_bound(TypeParam(), set.size()));
+    }
+  }
+  ASSERT_EQ(set.size(), expected.size());
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), expected.begin()));
+  EXPECT_LE(set.height(), height_bound(TypeParam(), set.size()));
+}
+
+TYPED_TEST(TreeBalance, SequentialIngestStaysShallow) {
+  balanced_set<TypeParam> set;
+  for (int i = 0; i < 100000; ++i) set.insert(i);
+  EXPECT_LE(set.height(), height_bound(TypeParam(), set.size()));
+  for (int i = 0; i < 100000; i += 2) set.erase(i);
+  EXPECT_LE(set.height(), height_bound(TypeParam(), set.size()));
+  EXPECT_EQ(*set.begin(), 1);
+  EXPECT_EQ(set.size(), 50000U);
+}
+
+TYPED_TEST(TreeBalance, MapAndMultiset) {
+  balanced_map<TypeParam> map{{3, "c"}, {1, "a"}, {2, "b"}};
+  map[4] = "d";
+  map.erase(2);
+  EXPECT_EQ(map.at(4), "d");
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_EQ(map.size(), 3U);
+
+  balanced_multiset<TypeParam> multiset{5, 1, 5, 3, 5};
+  EXPECT_EQ(multiset.count(5), 3U);
+  EXPECT_EQ(multiset.erase(5), 3U);
+  EXPECT_EQ(multiset.size(), 2U);
+}
+
+TYPED_TEST(TreeBalance, SnapshotLoadKeepsInvariants) {
+  const std::string path = "tree_balance_snapshot.bin";
+  balanced_set<TypeParam> original;
+  for (int i = 0; i < 1000; ++i) original.insert(i * 2);
+  original.save(path);
+  auto loaded = balanced_set<TypeParam>::load(path);
+  std::remove(path.c_str());
+  EXPECT_EQ(loaded.height(), 10U);
+
+  std::mt19937 rng(5);
+  for (int i = 0; i < 5000; ++i) {
+    int key = rng() % 3000;
+    if (rng() % 2) {
+      loaded.insert(key);
+    } else {
+      loaded.erase(key);
+    }
+  }
+  EXPECT_LE(loaded.height(), height_bound(TypeParam(), loaded.size()));
+  EXPECT_TRUE(std::is_sorted(loaded.begin(), loaded.end()));
+}
+
+TYPED_TEST(TreeBalance, AugmentationFollowsRotations) {
+  s21::aggregate_map<int, long, s21::sum_monoid<long>, std::less<int>,
+                     std::allocator<std::pair<const int, long>>, TypeParam>
+      totals;
+  std::map<int, long> expected;
+  std::mt19937 rng(3);
+  for (int i = 0; i < 20000; ++i) {
+    int key = rng() % 2000;
+    if (rng() % 4) {
+      totals.insert_or_assign(key, i);
+      expected[key] = i;
+    } else {
+      totals.erase(key);
+      expected.erase(key);
+    }
+  }
+  long sum = 0, range = 0;
+  for (const auto &item : expected) {
+    sum += item.second;
+    if (item.first >= 500 && item.first < 1500) range += item.second;
+  }
+  EXPECT_EQ(totals.aggregate(), sum);
+  EXPECT_EQ(totals.aggregate(500, 1500), range);
+}
+
+TEST(TreeBalance_Weight, RankAndSelect) {
+  balanced_set<s21::weight_balance> set;
+  for (int i = 0; i < 1000; ++i) set.insert(i * 3);
+  for (int i = 0; i < 1000; i += 2) set.erase(i * 3);
+  EXPECT_EQ(*set.nth(0), 3);
+  EXPECT_EQ(*set.nth(10), 63);
+  EXPECT_EQ(set.nth(500), set.end());
+  EXPECT_EQ(set.rank(0), 0U);
+  EXPECT_EQ(set.rank(63), 10U);
+  EXPECT_EQ(set.rank(64), 11U);
+  EXPECT_EQ(set.rank(100000), 500U);
+
+  balanced_map<s21::weight_balance> map{{10, "x"}, {20, "y"}, {30, "z"}};
+  EXPECT_EQ(*map.nth(1), "y");
+  EXPECT_EQ(map.rank(25), 2U);
+}
+
+TEST(TreeBalance_RedBlack, FewerRotationsThanAvl) {
+  s21::set<int, std::less<int>, std::allocator<int>, s21::tree_stats> avl;
+  s21::set<int, std::less<int>, std::allocator<int>, s21::tree_stats,
+           s21::red_black_balance>
+      red_black;
+  std::mt19937 rng(9);
+  for (int i = 0; i < 100000; ++i) {
+    int key = static_cast<int>(rng());
+    avl.insert(key);
+    red_black.insert(key);
+  }
+  auto rotations = [](const s21::tree_stats &stats) {
+    return stats.single_rotations + 2 * stats.double_rotations;
+  };
+  EXPECT_LT(rotations(red_black.stats()), rotations(avl.stats()));
+  EXPECT_GE(red_black.height(), avl.height());
+}
@@ -1,5 +1,91 @@
+#include <cstdint>
+#include <forward_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
 #include "s21_tests.h"
 
+namespace {
+// Counts live objects and move constructions; copying throws once
+// copies_left runs out
+struct tracked {
+  static inline int live = 0;
+  static inline int moves = 0;
+  static inline int copies_left = -1;
+  int value;
+
+  tracked(int v = 0) : value(v) { ++live; }
+  tracked(const tracked &other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy failed");
+    if (copies_left > 0) --copies_left;
+    ++live;
+  }
+  tracked(tracked &&other) noexcept : value(other.value) {
+    ++live;
+    ++moves;
+  }
+  tracked &operator=(const tracked &) = default;
+  ~tracked() { --live; }
+};
+
+// Owns its payload through a pointer, so its bytes can be moved
+struct handle {
+  static inline int moves = 0;
+  std::unique_ptr<int> payload;
+
+  explicit handle(int v) : payload(std::make_unique<int>(v)) {}
+  handle(handle &&other) noexcept : payload(std::move(other.payload)) {
+    ++moves;
+  }
+};
+
+// Stateful allocator: allocators with different ids cannot free each
+// other's memory. Counts outstanding allocations; Propagate sets all three
+// propagation traits.
+template <typename T, class Propagate>
+struct counting_allocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = Propagate;
+  using propagate_on_container_move_assignment = Propagate;
+  using propagate_on_container_swap = Propagate;
+
+  int id;
+  int *outstanding;
+
+  counting_allocator(int id, int *outstanding)
+      : id(id), outstanding(outstanding) {}
+
+  T *allocate(std::size_t n) {
+    ++*outstanding;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *p, std::size_t n) {
+    --*outstanding;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  counting_allocator select_on_container_copy_construction() const {
+    return {id + 100, outstanding};
+  }
+
+  bool operator==(const counting_allocator &other) const {
+    return id == other.id;
+  }
+
+  bool operator!=(const counting_allocator &other) const {
+    return id != other.id;
+  }
+};
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<handle> : std::true_type {};
+
 using namespace s21;
 
 TEST(VectorTest, DefaultConstructor) {
@@ -282,3 +368,354 @@ TEST(VectorEmplaceBack, StringType) {
   EXPECT_EQ(v[0], "Hello");
   EXPECT_EQ(v[1], "World");
 }
+
+TEST(VectorRelocate, LifetimesBalance) {
+  tracked::live = 0;
+  {
+    s21::vector<tracked> v;
+    for (int i = 0; i < 100; ++i) v.push_back(tracked(i));
+    v.insert(v.begin() + 10, tracked(-1));
+    v.insert(v.begin(), v[50]);
+    v.erase(v.begin() + 3);
+    v.erase(v.end() - 1);
+    v.shrink_to_fit();
+    s21::vector<tracked> copy(v);
+    v.resize(20);
+    EXPECT_EQ(tracked::live, 20 + 100);
+    EXPECT_EQ(copy[0].value, 49);
+    EXPECT_EQ(copy[10].value, -1);
+    EXPECT_EQ(copy[99].value, 98);
+    EXPECT_EQ(copy.size(), 100);
+  }
+  EXPECT_EQ(tracked::live, 0);
+}
+
+TEST(VectorRelocate, OptInTraitMovesBytes) {
+  handle::moves = 0;
+  s21::vector<handle> v;
+  for (int i = 0; i < 1000; ++i) v.emplace_back(i);
+  v.insert_many(v.begin());
+  v.erase(v.begin());
+  v.shrink_to_fit();
+  EXPECT_EQ(handle::moves, 0);
+  EXPECT_EQ(v.size(), 999);
+  EXPECT_EQ(*v[0].payload, 1);
+  EXPECT_EQ(*v[998].payload, 999);
+}
+
+TEST(VectorRelocate, InsertElementOfItself) {
+  s21::vector<std::string> v{"a", "b", "c"};
+  v.insert(v.begin(), v[2]);
+  v.insert(v.end(), v[0]);
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v[0], "c");
+  EXPECT_EQ(v[1], "a");
+  EXPECT_EQ(v[4], "c");
+  v.erase(v.begin() + 1);
+  EXPECT_EQ(v[1], "b");
+}
+
+TEST(VectorRangeEdit, InsertCopiesAndRanges) {
+  s21::vector<int> v{1, 2, 3};
+  auto it = v.insert(v.begin() + 1, 3, 7);
+  EXPECT_EQ(it, v.begin() + 1);
+  EXPECT_EQ(v.size(), 6);
+  EXPECT_EQ(v[3], 7);
+  EXPECT_EQ(v[4], 2);
+
+  const int more[] = {10, 11, 12};
+  it = v.insert(v.end(), more, more + 3);
+  EXPECT_EQ(*it, 10);
+  EXPECT_EQ(v.size(), 9);
+
+  std::forward_list<int> list{-1, -2};
+  v.insert(v.begin(), list.begin(), list.end());
+  EXPECT_EQ(v[0], -1);
+  EXPECT_EQ(v[2], 1);
+
+  std::istringstream in("20 21 22");
+  it = v.insert(v.begin() + 2, std::istream_iterator<int>(in),
+                std::istream_iterator<int>());
+  EXPECT_EQ(it, v.begin() + 2);
+  EXPECT_EQ(v.size(), 14);
+  EXPECT_EQ(v[4], 22);
+  EXPECT_EQ(v[5], 1);
+  EXPECT_EQ(v[13], 12);
+
+  v.insert(v.begin(), 2, v[13]);
+  EXPECT_EQ(v[0], 12);
+  EXPECT_EQ(v[1], 12);
+  v.insert(v.begin(), 0, 5);
+  EXPECT_EQ(v.size(), 16);
+}
+
+TEST(VectorRangeEdit, TailMovesOnce) {
+  tracked::moves = 0;
+  s21::vector<tracked> v;
+  v.reserve(200);
+  for (int i = 0; i < 100; ++i) v.emplace_back(i);
+  auto it = v.insert_many(v.begin() + 10, tracked(-1), tracked(-2), 5);
+  EXPECT_EQ(tracked::moves, 90 + 2);
+  EXPECT_EQ(it, v.begin() + 13);
+  EXPECT_EQ(v[12].value, 5);
+  EXPECT_EQ(v[13].value, 10);
+
+  tracked::moves = 0;
+  it = v.erase(v.begin() + 1, v.begin() + 51);
+  EXPECT_EQ(tracked::moves, 52);
+  EXPECT_EQ(it->value, 48);
+  EXPECT_EQ(v.size(), 53);
+  EXPECT_EQ(v.erase(v.begin(), v.begin()), v.begin());
+
+  tracked::moves = 0;
+  v.emplace(v.begin() + 3, 77);
+  EXPECT_EQ(tracked::moves, 50);
+  EXPECT_EQ(v[3].value, 77);
+}
+
+TEST(VectorRangeEdit, ElementsOfItself) {
+  s21::vector<std::string> v{"a", "b", "c"};
+  v.insert_many(v.begin(), v[2], v[1]);
+  v.emplace(v.begin() + 1, v[4]);
+  ASSERT_EQ(v.size(), 6);
+  EXPECT_EQ(v[0], "c");
+  EXPECT_EQ(v[1], "c");
+  EXPECT_EQ(v[2], "b");
+  EXPECT_EQ(v[5], "c");
+  v.emplace(v.begin(), 3, 'x');
+  EXPECT_EQ(v[0], "xxx");
+}
+
+TEST(VectorRangeEdit, FailedInsertLeavesVectorIntact) {
+  tracked::live = 0;
+  {
+    s21::vector<tracked> v;
+    for (int i = 0; i < 10; ++i) v.emplace_back(i);
+    const tracked value(-1);
+    for (bool reallocates : {false, true}) {
+      v.shrink_to_fit();
+      if (!reallocates) v.reserve(20);
+      tracked::copies_left = 2;
+      EXPECT_THROW(v.insert(v.begin() + 4, 3, value), std::runtime_error);
+      tracked::copies_left = -1;
+      ASSERT_EQ(v.size(), 10);
+      for (int i = 0; i < 10; ++i) EXPECT_EQ(v[i].value, i);
+      EXPECT_EQ(tracked::live, 11);
+    }
+  }
+  EXPECT_EQ(tracked::live, 0);
+}
+
+static_assert(s21::size_class_growth::size_class(1) == 16);
+static_assert(s21::size_class_growth::size_class(129) == 160);
+static_assert(s21::size_class_growth::size_class(3000) == 3072);
+static_assert(s21::size_class_growth::size_class(4097) == 8192);
+
+TEST(VectorGrowth, PolicyCapacities) {
+  s21::vector<int> doubling;
+  s21::vector<int, std::allocator<int>, s21::one_and_half_growth> half;
+  s21::vector<int, std::allocator<int>, s21::size_class_growth> classes;
+  s21::vector<std::size_t> seen[3];
+  for (int i = 0; i < 100; ++i) {
+    doubling.push_back(i);
+    half.push_back(i);
+    classes.push_back(i);
+    std::size_t capacities[] = {doubling.capacity(), half.capacity(),
+                                classes.capacity()};
+    for (int p = 0; p < 3; ++p) {
+      if (seen[p].empty() || seen[p][seen[p].size() - 1] != capacities[p]) {
+        seen[p].push_back(capacities[p]);
+      }
+    }
+  }
+  EXPECT_EQ(seen[0][7], 128);
+  std::size_t half_steps[] = {1, 2, 3, 4, 6, 9, 13, 19, 28, 42, 63, 94, 141};
+  ASSERT_EQ(seen[1].size(), 13);
+  for (int i = 0; i < 13; ++i) EXPECT_EQ(seen[1][i], half_steps[i]);
+  std::size_t class_steps[] = {4, 8, 12, 20, 32, 48, 80, 128};
+  ASSERT_EQ(seen[2].size(), 8);
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(seen[2][i], class_steps[i]);
+  EXPECT_EQ(classes[99], 99);
+  EXPECT_EQ(half[50], 50);
+}
+
+TEST(VectorGrowth, PushBackOwnElementIntoFullBuffer) {
+  s21::vector<std::string> strings{"first", "second"};
+  strings.shrink_to_fit();
+  strings.push_back(strings[0]);
+  strings.emplace_back(strings[2]);
+  EXPECT_EQ(strings[3], "first");
+
+  s21::vector<int, std::allocator<int>, s21::one_and_half_growth> ints{7};
+  for (int i = 0; i < 20; ++i) ints.push_back(ints[ints.size() - 1] + 1);
+  EXPECT_EQ(ints[20], 27);
+}
+
+TEST(VectorGrowth, ReallocatedHandlesKeepPayloads) {
+  handle::moves = 0;
+  s21::vector<handle, std::allocator<handle>, s21::size_class_growth> v;
+  for (int i = 0; i < 5000; ++i) v.emplace_back(i);
+  v.insert(v.begin(), handle(-1));
+  v.shrink_to_fit();
+  EXPECT_EQ(handle::moves, 1);
+  EXPECT_EQ(*v[0].payload, -1);
+  EXPECT_EQ(*v[5000].payload, 4999);
+  v.clear();
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 0);
+}
+
+TEST(VectorAllocator, StatefulAllocatorServesEveryBuffer) {
+  using allocator = counting_allocator<tracked, std::false_type>;
+  int outstanding = 0;
+  {
+    s21::vector<tracked, allocator> v(allocator(1, &outstanding));
+    for (int i = 0; i < 100; ++i) v.emplace_back(i);
+    v.insert(v.begin(), 3, tracked(-1));
+    EXPECT_EQ(outstanding, 1);
+    EXPECT_EQ(v.get_allocator().id, 1);
+    EXPECT_EQ(v[0].value, -1);
+    EXPECT_EQ(v[102].value, 99);
+
+    s21::vector<tracked, allocator> copy(v);
+    EXPECT_EQ(copy.get_allocator().id, 101);
+    s21::vector<tracked, allocator> moved(std::move(copy));
+    EXPECT_EQ(moved.get_allocator().id, 101);
+    EXPECT_EQ(moved.size(), 103);
+    EXPECT_EQ(outstanding, 2);
+  }
+  EXPECT_EQ(outstanding, 0);
+  EXPECT_EQ(tracked::live, 0);
+}
+
+TEST(VectorAllocator, PropagationTraits) {
+  int outstanding = 0;
+  {
+    using sticky = counting_allocator<int, std::false_type>;
+    s21::vector<int, sticky> a({1, 2, 3}, sticky(1, &outstanding));
+    s21::vector<int, sticky> b({4, 5}, sticky(2, &outstanding));
+    b = a;
+    EXPECT_EQ(b.get_allocator().id, 2);
+    const int *buffer = a.data();
+    b = std::move(a);
+    EXPECT_EQ(b.get_allocator().id, 2);
+    EXPECT_NE(b.data(), buffer);
+    EXPECT_EQ(b.size(), 3);
+    EXPECT_EQ(b[2], 3);
+
+    s21::vector<int, sticky> c({6}, sticky(2, &outstanding));
+    buffer = c.data();
+    b = std::move(c);
+    EXPECT_EQ(b.data(), buffer);
+
+    using moving = counting_allocator<int, std::true_type>;
+    s21::vector<int, moving> d({1, 2, 3}, moving(3, &outstanding));
+    s21::vector<int, moving> e({4}, moving(4, &outstanding));
+    e = d;
+    EXPECT_EQ(e.get_allocator().id, 3);
+    EXPECT_EQ(e[2], 3);
+    buffer = d.data();
+    s21::vector<int, moving> f({5}, moving(5, &outstanding));
+    f = std::move(d);
+    EXPECT_EQ(f.get_allocator().id, 3);
+    EXPECT_EQ(f.data(), buffer);
+    f.swap(e);
+    EXPECT_EQ(f.get_allocator().id, 3);
+    EXPECT_EQ(e.data(), buffer);
+  }
+  EXPECT_EQ(outstanding, 0);
+}
+
+TEST(VectorAllocator, ArenaBackedVector) {
+  auto pool = std::make_shared<s21::arena>();
+  s21::arena_allocator<std::string> alloc(pool);
+  s21::vector<std::string, s21::arena_allocator<std::string>> v(alloc);
+  for (int i = 0; i < 1000; ++i) v.push_back(std::to_string(i));
+  v.erase(v.begin(), v.begin() + 10);
+  EXPECT_EQ(v[0], "10");
+  EXPECT_EQ(v.get_allocator().resource(), pool);
+  EXPECT_GE(pool->reserved(), 1000 * sizeof(std::string));
+}
+
+TEST(VectorAllocator, ScopedAllocatorReachesElements) {
+  std::pmr::monotonic_buffer_resource resource;
+  using allocator = std::pmr::polymorphic_allocator<std::pmr::string>;
+  s21::vector<std::pmr::string, allocator> v{allocator(&resource)};
+  v.emplace_back("a string too long for the small string buffer");
+  v.insert(v.begin(), 2, v[0]);
+  v.resize(5);
+  for (const auto &s : v) EXPECT_EQ(s.get_allocator().resource(), &resource);
+  EXPECT_EQ(v[1], v[2]);
+}
+
+TEST(VectorAllocator, AlignedBuffers) {
+  s21::vector<float, s21::aligned_allocator<float, 64>> v;
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(static_cast<float>(i));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 64, 0u);
+  }
+  v.shrink_to_fit();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 64, 0u);
+  EXPECT_EQ(v[999], 999.0f);
+  static_assert(s21::aligned_allocator<char, 1>::kAlignment == 1);
+  static_assert(s21::aligned_allocator<double, 2>::kAlignment == 8);
+  static_assert(sizeof(v) == sizeof(s21::vector<float>));
+  static_assert(sizeof(v) == 3 * sizeof(void *));
+}
+
+TEST(VectorUninitialized, ResizeDefaultInitLeavesBytes) {
+  s21::vector<char> v(16);
+  std::fill(v.begin(), v.end(), 'x');
+  v.resize(4);
+  v.resize_uninitialized(16);
+  EXPECT_EQ(v.size(), 16);
+  EXPECT_EQ(v[3], 'x');
+  EXPECT_EQ(v[15], 'x');  // the shrink left the bytes behind, not zeroes
+  v.resize_default_init(2);
+  EXPECT_EQ(v.size(), 2);
+
+  s21::vector<float> floats(100, s21::default_init);
+  EXPECT_EQ(floats.size(), 100);
+  EXPECT_EQ(floats.capacity(), 100);
+}
+
+TEST(VectorUninitialized, ResizeDefaultInitConstructsClasses) {
+  tracked::live = 0;
+  {
+    s21::vector<tracked> v{1, 2};
+    v.resize_default_init(5);
+    EXPECT_EQ(v[1].value, 2);
+    EXPECT_EQ(v[4].value, 0);
+    EXPECT_EQ(tracked::live, 5);
+    s21::vector<std::string> strings(3, s21::default_init);
+    EXPECT_TRUE(strings[2].empty());
+  }
+  EXPECT_EQ(tracked::live, 0);
+}
+
+TEST(VectorUninitialized, AppendUninitializedFillsInPlace) {
+  std::istringstream source(std::string(10000, 'a') + "end");
+  s21::vector<char> buffer{'>'};
+  std::size_t growths = 0;
+  while (source) {
+    std::size_t before = buffer.capacity();
+    char *slots = buffer.append_uninitialized(64);
+    source.read(slots, 64);
+    buffer.resize(buffer.size() - 64 + source.gcount());
+    if (buffer.capacity() != before) ++growths;
+  }
+  ASSERT_EQ(buffer.size(), 10004);
+  EXPECT_EQ(buffer[0], '>');
+  EXPECT_EQ(buffer[1], 'a');
+  EXPECT_EQ(std::string(buffer.end() - 3, buffer.end()), "end");
+  EXPECT_LE(growths, 10);
+
+  s21::vector<int> ints{1, 2};
+  int *tail = ints.append_uninitialized(3);
+  for (int i = 0; i < 3; ++i) tail[i] = i + 3;
+  EXPECT_EQ(ints.size(), 5);
+  EXPECT_EQ(ints[4], 5);
+  EXPECT_EQ(ints.append_uninitialized(0), ints.end());
+  EXPECT_THROW(ints.append_uninitialized(ints.max_size()), std::length_error);
+  EXPECT_EQ(ints.size(), 5);
+}